@@ -18,16 +18,38 @@ const lib_sources = &[_][]const u8{
     "lib/Graph.cpp",
     "lib/GraphMatrix.cpp",
     "lib/GraphTypes.cpp",
+    "lib/GraphCSR.cpp",
+    "lib/MappedFile.cpp",
+    "lib/GraphFile.cpp",
+    "lib/GraphImport.cpp",
+    "lib/GraphExport.cpp",
+    "lib/CompressedGraph.cpp",
+    "lib/Coarsening.cpp",
+    "lib/SymmetricEigen.cpp",
     "lib/Algo/Hakimi.cpp",
     "lib/Algo/Kruskal.cpp",
     "lib/Algo/BFS.cpp",
     "lib/Algo/DFS.cpp",
+    "lib/Algo/Centrality.cpp",
+    "lib/Algo/Betweenness.cpp",
+    "lib/Algo/Coloring.cpp",
+    "lib/Algo/MaxFlow.cpp",
+    "lib/Algo/Matching.cpp",
+    "lib/Algo/Topological.cpp",
+    "lib/Algo/Eulerian.cpp",
+    "lib/Algo/ConfigurationModel.cpp",
+    "lib/Layout/ForceLayout.cpp",
+    "lib/Layout/MultilevelLayout.cpp",
+    "lib/Layout/SpectralLayout.cpp",
+    "lib/Layout/StressLayout.cpp",
 };
 
 const app_c_sources = &[_][]const u8{"src/vendor.c"};
 const app_cxx_sources = &[_][]const u8{
     "src/main.cpp",
     "src/GraphView.cpp",
+    "src/Workspace.cpp",
+    "src/LayoutWorker.cpp",
     "src/Graphexia.cpp",
     "src/GPXRenderer.cpp",
     "src/GPXFontRenderer.cpp",
@@ -35,6 +57,22 @@ const app_cxx_sources = &[_][]const u8{
     "src/Util/BMFont.cpp",
 };
 
+// Every test is its own executable (tests/Test.hpp), `zig build test` builds and runs all of them
+const Test = struct {
+    name: []const u8,
+    sources: []const []const u8,
+};
+const tests = &[_]Test{
+    .{ .name = "Random", .sources = &.{"tests/Random.cpp"} },
+    .{ .name = "GraphFile", .sources = &.{"tests/GraphFile.cpp"} },
+    .{ .name = "GraphImport", .sources = &.{"tests/GraphImport.cpp"} },
+    .{ .name = "GraphExport", .sources = &.{"tests/GraphExport.cpp"} },
+    .{ .name = "CompressedGraph", .sources = &.{"tests/CompressedGraph.cpp"} },
+    .{ .name = "Eulerian", .sources = &.{"tests/Eulerian.cpp"} },
+    .{ .name = "Layout", .sources = &.{"tests/Layout.cpp"} },
+    .{ .name = "Workspace", .sources = &.{ "tests/Workspace.cpp", "src/GraphView.cpp", "src/Workspace.cpp" } },
+};
+
 const app_shaders_dir = "assets/shaders/";
 const app_shaders = &[_][]const u8{
     "Graph.glsl",
@@ -43,6 +81,8 @@ const app_shaders = &[_][]const u8{
 
 const lib_flags = &[_][]const u8{
     "-std=c++23",
+    // Nothing reads errno, without it sqrt in the layout kernels can be vectorized
+    "-fno-math-errno",
 };
 const app_flags = &[_][]const u8{
     "",
@@ -169,6 +209,37 @@ fn buildNative(b: *std.Build, lib: *std.Build.Step.Compile, target: std.Build.Re
 
     const run_step = b.addRunArtifact(app);
     buildShared(b, app, lib, run_step);
+    buildTests(b, lib, target, optimize);
+}
+
+fn buildTests(b: *std.Build, lib: *std.Build.Step.Compile, target: std.Build.ResolvedTarget, optimize: std.builtin.OptimizeMode) void {
+    const test_step = b.step("test", "Build and run the tests");
+
+    inline for (tests) |t| {
+        const exe = b.addExecutable(.{
+            .name = "test-" ++ t.name,
+            .target = target,
+            .optimize = optimize,
+        });
+        exe.linkLibC();
+        exe.linkLibCpp();
+
+        if (target.result.os.tag == .linux) {
+            exe.linkSystemLibrary("pthread");
+        }
+
+        exe.addCSourceFiles(.{
+            .files = t.sources,
+            .flags = lib_flags,
+        });
+        exe.addIncludePath(b.path("include/"));
+        exe.addIncludePath(b.path("src/"));
+        exe.addIncludePath(b.path("vendor/include/"));
+        exe.linkLibrary(lib);
+
+        const run = b.addRunArtifact(exe);
+        test_step.dependOn(&run.step);
+    }
 }
 
 fn buildWeb(b: *std.Build, lib: *std.Build.Step.Compile, target: std.Build.ResolvedTarget, optimize: std.builtin.OptimizeMode, options: Options) !void {
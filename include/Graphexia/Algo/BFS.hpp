@@ -2,9 +2,9 @@
 #define _GRAPHEXIA_ALGO_BFS__HPP_
 
 #include <Graphexia/Graph.hpp>
+#include <Graphexia/GraphConcept.hpp>
 
 #include <optional>
-#include <unordered_set>
 #include <vector>
 
 namespace gpx {
@@ -14,12 +14,81 @@ namespace gpx {
         std::vector<usize> toVisit;
         usize current;
 
-        std::unordered_set<usize> visitedVertices;
+        // One bit per vertex, O(V) memory for any graph (implicit ones included). Grows with the graph.
+        std::vector<bool> visitedVertices;
         std::vector<usize> result;
     };
 
-    BFSState SetupBFS(const gpx::Graph& graph, usize from, std::optional<usize> to);
-    bool IterateBFS(const gpx::Graph& graph, BFSState& state);
+    template<AdjacencyGraph G>
+    BFSState SetupBFS(const G& graph, usize from, std::optional<usize> to) {
+        std::vector<bool> visitedVertices(graph.Vertices());
+        visitedVertices[from] = true;
+
+        return {
+            to,
+            std::vector<usize>{from},
+            std::vector<usize>(),
+            0,
+            std::move(visitedVertices),
+            std::vector<usize>() 
+        };
+    }
+
+    template<AdjacencyGraph G>
+    bool IterateBFS(const G& graph, BFSState& state) {
+        // The graph may have been edited between steps, new vertices are unvisited and erased ones are skipped
+        if(state.visitedVertices.size() < graph.Vertices()) {
+            state.visitedVertices.resize(graph.Vertices());
+        }
+
+        while (true) {
+            if(state.current < state.visiting.size()) {
+                usize id = state.visiting[state.current++];
+                if(id >= graph.Vertices()) {
+                    continue;
+                }
+
+                usize addedCount = 0;
+                bool found = false;
+                graph.ForEachAdjacent(id, [&](usize adjacentVertex, usize adjacentEdge) {
+                    if(found || state.visitedVertices[adjacentVertex]) {
+                        return;
+                    }
+
+                    state.visitedVertices[adjacentVertex] = true;
+                    state.toVisit.push_back(adjacentVertex);
+                    state.result.push_back(adjacentEdge);
+                    ++addedCount;
+
+                    found = state.targetVertex && *state.targetVertex == adjacentVertex;
+                });
+
+                if(found) { // We finished!
+                    state.toVisit.clear();
+                    state.visiting.clear();
+                    state.current = 0;
+                    return true;
+                }
+
+                if(addedCount == 0) { // This vertex didn't have anything interesting
+                    continue;
+                }
+
+                return false;
+            }
+            
+            if(state.toVisit.empty()) {
+                return true;
+            }
+
+            state.current = 0;
+            state.visiting.swap(state.toVisit);
+            state.toVisit.clear();
+        }
+    }
+
+    extern template BFSState SetupBFS<Graph>(const Graph& graph, usize from, std::optional<usize> to);
+    extern template bool IterateBFS<Graph>(const Graph& graph, BFSState& state);
 } // namespace gpx
 
 #endif
@@ -0,0 +1,33 @@
+#ifndef _GRAPHEXIA_ALGO_BETWEENNESS__HPP_
+#define _GRAPHEXIA_ALGO_BETWEENNESS__HPP_
+
+#include <Graphexia/Graph.hpp>
+#include <vector>
+
+namespace gpx {
+    struct BetweennessOptions {
+        // 0 means exact, every vertex is used as a source
+        usize samples = 0;
+        u64 seed = 0;
+        // 0 means all hardware threads
+        usize threads = 0;
+        bool normalized = false;
+        // Probability that any vertex exceeds the reported error bound when sampling
+        f64 failureProbability = 0.05;
+    };
+
+    struct BetweennessResult {
+        std::vector<f64> vertices;
+        std::vector<f64> edges;
+        usize sources;
+        // Maximum absolute error of the normalized vertex betweenness (with probability 1 - failureProbability), 0 when exact
+        f64 errorBound;
+    };
+
+    // Brandes' algorithm over unweighted shortest paths. Undirected pairs are only counted once.
+    BetweennessResult Betweenness(const Graph& graph, const BetweennessOptions& options = {});
+    // Number of samples needed so that the normalized vertex betweenness is within epsilon with probability 1 - failureProbability
+    usize BetweennessSamplesFor(usize vertices, f64 epsilon, f64 failureProbability = 0.05);
+} // namespace gpx
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef _GRAPHEXIA_ALGO_CENTRALITY__HPP_
+#define _GRAPHEXIA_ALGO_CENTRALITY__HPP_
+
+#include <Graphexia/Graph.hpp>
+#include <vector>
+
+namespace gpx {
+    struct CentralityOptions {
+        // Iteration stops when the L1 difference between two iterations is below Vertices() * tolerance
+        f64 tolerance = 1e-6;
+        usize maxIterations = 100;
+        // 0 means all hardware threads
+        usize threads = 0;
+        // Accumulate in f32 instead of f64, twice as many SIMD lanes at the cost of precision
+        bool singlePrecision = false;
+    };
+
+    struct CentralityResult {
+        std::vector<f64> scores;
+        usize iterations;
+        bool converged;
+    };
+
+    CentralityResult PageRank(const Graph& graph, f64 damping = 0.85, const CentralityOptions& options = {});
+    // Scores are normalized to unit L2 norm
+    CentralityResult EigenvectorCentrality(const Graph& graph, const CentralityOptions& options = {});
+    // Scores are normalized to unit L2 norm, alpha must be less than 1 / (largest eigenvalue of the adjacency matrix) to converge
+    CentralityResult KatzCentrality(const Graph& graph, f64 alpha = 0.1, f64 beta = 1, const CentralityOptions& options = {});
+    // An alpha Katz always converges with: fraction / (max degree), the largest eigenvalue of the adjacency matrix is never above
+    // the max degree (counting in and out edges). Error shrinks at least by fraction every iteration.
+    f64 KatzAlphaFor(const Graph& graph, f64 fraction = 0.5);
+} // namespace gpx
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef _GRAPHEXIA_ALGO_COLORING__HPP_
+#define _GRAPHEXIA_ALGO_COLORING__HPP_
+
+#include <Graphexia/Graph.hpp>
+#include <vector>
+
+namespace gpx {
+    enum class ColoringOrder : u8 {
+        Natural,
+        LargestFirst,
+        SmallestLast
+    };
+
+    // Edge directions are ignored and loops can't be properly colored, so they are skipped
+    struct ColoringResult {
+        std::vector<usize> colors;
+        usize colorCount;
+    };
+
+    ColoringResult GreedyColoring(const Graph& graph, ColoringOrder order = ColoringOrder::LargestFirst);
+    // Buckets vertices by saturation degree, ties are broken (approximately) by degree
+    ColoringResult DSaturColoring(const Graph& graph);
+    // Vertices get a random priority and are colored as soon as all their higher priority neighbours are, in parallel rounds
+    ColoringResult JonesPlassmannColoring(const Graph& graph, u64 seed = 0, usize threads = 0);
+
+    bool IsProperColoring(const Graph& graph, const std::vector<usize>& colors);
+} // namespace gpx
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef _GRAPHEXIA_ALGO_CONFIGURATIONMODEL__HPP_
+#define _GRAPHEXIA_ALGO_CONFIGURATIONMODEL__HPP_
+
+#include <Graphexia/Graph.hpp>
+
+#include <optional>
+#include <span>
+
+namespace gpx {
+    // Random simple graph with the given degrees: stubs are paired at random and every loop or parallel edge is then rejected
+    // and repaired with a random degree preserving swap. If that gets stuck (very dense sequences) the Havel-Hakimi realization is
+    // shuffled instead. Returns nothing if the sequence is not graphic.
+    // Nothing is shared between calls, different seeds can run concurrently.
+    std::optional<Graph> CreateConfigurationModel(std::span<usize> sequence, u64 seed = 0);
+
+    // Markov chain of degree preserving double edge swaps (a-b, c-d => a-d, c-b) that keeps the graph simple.
+    // Edge directions and weights are dropped, swapsPerEdge ~10 is usually enough to mix.
+    Graph DegreePreservingShuffle(const Graph& graph, usize swapsPerEdge = 10, u64 seed = 0);
+} // namespace gpx
+
+#endif
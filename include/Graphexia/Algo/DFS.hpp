@@ -2,9 +2,10 @@
 #define _GRAPHEXIA_ALGO_DFS__HPP_
 
 #include <Graphexia/Graph.hpp>
+#include <Graphexia/GraphConcept.hpp>
 
 #include <optional>
-#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace gpx {
@@ -14,12 +15,83 @@ namespace gpx {
         std::vector<std::pair<usize, usize>> visiting;
         usize last;
 
-        std::unordered_set<usize> visitedVertices;
+        // One bit per vertex, O(V) memory for any graph (implicit ones included). Grows with the graph.
+        std::vector<bool> visitedVertices;
         std::vector<usize> result;
     };
 
-    DFSState SetupDFS(const gpx::Graph& graph, usize from, std::optional<usize> to);
-    bool IterateDFS(const gpx::Graph& graph, DFSState& state);
+    template<AdjacencyGraph G>
+    DFSState SetupDFS(const G& graph, usize from, std::optional<usize> to) {
+        std::vector<std::pair<usize, usize>> visiting;
+
+        graph.ForEachAdjacent(from, [&visiting, from](usize adjacentVertex, usize adjacentEdge) {
+            if(adjacentVertex == from) { // Cannot use this edge
+                return;
+            }
+
+            visiting.push_back(std::make_pair(adjacentVertex, adjacentEdge));
+        });
+
+        std::vector<bool> visitedVertices(graph.Vertices());
+        visitedVertices[from] = true;
+
+        return {
+            to,
+            std::move(visiting),
+            from,
+
+            std::move(visitedVertices),
+            std::vector<usize>()
+        };
+    }
+
+    template<AdjacencyGraph G>
+    bool IterateDFS(const G& graph, DFSState& state) {
+        // The graph may have been edited between steps, new vertices are unvisited and erased ones are skipped
+        if(state.visitedVertices.size() < graph.Vertices()) {
+            state.visitedVertices.resize(graph.Vertices());
+        }
+
+        while(!state.visiting.empty()) {
+            auto [vertexId, edgeId] = state.visiting.back();
+            state.visiting.pop_back();
+
+            if(vertexId >= graph.Vertices()) {
+                continue;
+            }
+            
+            if(state.targetVertex && *state.targetVertex == vertexId) {
+                state.last = vertexId;
+                state.visiting.clear();
+                state.visitedVertices[vertexId] = true;
+                state.result.push_back(edgeId);
+                return true;
+            }
+
+            // It may happen when graphs have loops!
+            if(state.visitedVertices[vertexId]) {
+                continue;
+            }
+
+            graph.ForEachAdjacent(vertexId, [&state](usize adjacentVertex, usize adjacentEdge) {
+                if(state.visitedVertices[adjacentVertex]) { // Already visited
+                    return;
+                }
+
+                state.visiting.push_back(std::make_pair(adjacentVertex, adjacentEdge));
+            });
+
+            state.last = vertexId;
+            state.visitedVertices[vertexId] = true;
+            state.result.push_back(edgeId);
+            return false;
+        }
+
+        return true;
+    }
+
+    extern template DFSState SetupDFS<Graph>(const Graph& graph, usize from, std::optional<usize> to);
+    extern template bool IterateDFS<Graph>(const Graph& graph, DFSState& state);
 } // namespace gpx
 
 #endif
@@ -0,0 +1,22 @@
+#ifndef _GRAPHEXIA_ALGO_EULERIAN__HPP_
+#define _GRAPHEXIA_ALGO_EULERIAN__HPP_
+
+#include <Graphexia/Graph.hpp>
+#include <vector>
+
+namespace gpx {
+    struct EulerianResult {
+        bool exists;
+        // The path starts and ends in the same vertex
+        bool circuit;
+        // Every edge exactly once, in traversal order
+        std::vector<usize> edges;
+        // edges.size() + 1 vertices visited along the path, vertex 0 alone when there are no edges (none without vertices)
+        std::vector<usize> vertices;
+    };
+
+    // Iterative Hierholzer in O(V + E), handles directed and undirected graphs, loops and parallel edges
+    EulerianResult EulerianPath(const Graph& graph);
+} // namespace gpx
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef _GRAPHEXIA_ALGO_MATCHING__HPP_
+#define _GRAPHEXIA_ALGO_MATCHING__HPP_
+
+#include <Graphexia/Graph.hpp>
+
+#include <optional>
+#include <vector>
+
+namespace gpx {
+    // Edge directions are ignored
+    struct BipartitionResult {
+        bool bipartite;
+        // Side (0 or 1) of every vertex, only meaningful when bipartite
+        std::vector<u8> sides;
+        // Edge ids of an odd cycle, in order, when not bipartite
+        std::vector<usize> oddCycle;
+    };
+
+    BipartitionResult Bipartition(const gpx::Graph& graph);
+
+    // Hopcroft-Karp maximum cardinality matching in O(E sqrt(V)), returns the matched edge ids or nothing if the graph is not bipartite
+    std::optional<std::vector<usize>> HopcroftKarp(const gpx::Graph& graph);
+    std::vector<usize> HopcroftKarp(const gpx::Graph& graph, const std::vector<u8>& sides);
+} // namespace gpx
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef _GRAPHEXIA_ALGO_MAXFLOW__HPP_
+#define _GRAPHEXIA_ALGO_MAXFLOW__HPP_
+
+#include <Graphexia/Graph.hpp>
+#include <vector>
+
+namespace gpx {
+    // Highest label push-relabel over the residual network of a graph, edge weights are the capacities (negative ones count as 0).
+    // Undirected edges can carry flow in any direction, loops are ignored.
+    struct MaxFlowState {
+        usize source, sink;
+
+        // Residual arcs grouped by tail vertex, every edge has a forward arc and a reverse arc
+        std::vector<usize> arcOffsets;
+        std::vector<usize> arcHeads;
+        std::vector<usize> arcReverse;
+        std::vector<usize> arcEdges;
+        std::vector<f64> residual;
+        // Forward arc of every edge
+        std::vector<usize> edgeArcs;
+
+        std::vector<usize> labels;
+        std::vector<f64> excess;
+        std::vector<usize> currentArcs;
+
+        // Active vertices bucketed by label
+        std::vector<usize> activeHeads;
+        std::vector<usize> activeNext;
+        usize highestActive;
+
+        // Every vertex with label < Vertices(), doubly linked by label, for the gap heuristic
+        std::vector<usize> labelHeads;
+        std::vector<usize> labelNext;
+        std::vector<usize> labelPrevious;
+
+        usize relabelsSinceGlobal;
+        usize current;
+
+        // Edges that received a push during the last iteration
+        std::vector<usize> result;
+    };
+
+    struct MaxFlowResult {
+        f64 value;
+        // Flow through every edge, negative when it goes from toId to fromId in undirected graphs
+        std::vector<f64> flows;
+        // Edges crossing the minimum s-t cut
+        std::vector<usize> minCut;
+    };
+
+    MaxFlowState SetupMaxFlow(const gpx::Graph& graph, usize source, usize sink);
+    // Discharges the highest active vertex, returns true when the flow is maximum
+    bool IterateMaxFlow(const gpx::Graph& graph, MaxFlowState& state);
+    MaxFlowResult MaxFlowFromState(const gpx::Graph& graph, const MaxFlowState& state);
+
+    MaxFlowResult MaxFlow(const gpx::Graph& graph, usize source, usize sink);
+} // namespace gpx
+
+#endif
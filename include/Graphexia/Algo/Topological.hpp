@@ -0,0 +1,34 @@
+#ifndef _GRAPHEXIA_ALGO_TOPOLOGICAL__HPP_
+#define _GRAPHEXIA_ALGO_TOPOLOGICAL__HPP_
+
+#include <Graphexia/Graph.hpp>
+#include <vector>
+
+namespace gpx {
+    // Edges always go from fromId to toId here, even if the graph is not flagged as directed
+    struct TopologicalOrder {
+        bool acyclic;
+        // Every vertex in topological order, or only the ones that could be ordered when there is a cycle
+        std::vector<usize> order;
+        // Edge ids of a directed cycle, in order, when not acyclic
+        std::vector<usize> cycle;
+    };
+
+    struct TopologicalLevels {
+        bool acyclic;
+        // Vertices grouped by level (longest path from a source), vertices of level i are vertices[levelOffsets[i]..levelOffsets[i + 1])
+        // Every level is sorted by id and only depends on previous levels, so it can be dispatched at once
+        std::vector<usize> vertices;
+        std::vector<usize> levelOffsets;
+        std::vector<usize> cycle;
+
+        usize Levels() const { return this->levelOffsets.empty() ? 0 : this->levelOffsets.size() - 1; }
+    };
+
+    // Kahn's algorithm
+    TopologicalOrder TopologicalSort(const Graph& graph);
+    // Kahn's algorithm processing a whole wavefront in parallel every round
+    TopologicalLevels TopologicalWavefronts(const Graph& graph, usize threads = 0);
+} // namespace gpx
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef _GRAPHEXIA_BUFFEREDSINK__HPP_
+#define _GRAPHEXIA_BUFFEREDSINK__HPP_
+
+#include <Graphexia/Core.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace gpx {
+    // Fixed size output buffer in front of a stream: text and numbers are formatted straight into it (std::to_chars) and only
+    // whole buffers reach the stream, so writing any amount of data needs 'capacity' bytes of memory.
+    struct BufferedSink final {
+        explicit BufferedSink(std::ostream& stream, usize capacity = 1 << 16)
+            : stream(stream), buffer(std::max<usize>(capacity, 64)), used() {}
+
+        BufferedSink(const BufferedSink&) = delete;
+        BufferedSink& operator=(const BufferedSink&) = delete;
+
+        ~BufferedSink() { this->Flush(); }
+
+        void Write(char character) {
+            if(this->used == this->buffer.size()) {
+                this->Flush();
+            }
+
+            this->buffer[this->used++] = character;
+        }
+
+        void Write(std::string_view text) {
+            while(!text.empty()) {
+                if(this->used == this->buffer.size()) {
+                    this->Flush();
+                }
+
+                usize count = std::min(text.size(), this->buffer.size() - this->used);
+                std::copy(text.begin(), text.begin() + count, this->buffer.begin() + this->used);
+
+                this->used += count;
+                text.remove_prefix(count);
+            }
+        }
+
+        // Integers and floats (shortest round trip representation)
+        template<typename T>
+        void WriteNumber(T value) {
+            // Enough for any 64 bit integer or float
+            constexpr usize Longest = 32;
+
+            if(this->buffer.size() - this->used < Longest) {
+                this->Flush();
+            }
+
+            std::to_chars_result result = std::to_chars(this->buffer.data() + this->used, this->buffer.data() + this->buffer.size(), value);
+            this->used = result.ptr - this->buffer.data();
+        }
+
+        bool Flush() {
+            if(this->used != 0) {
+                this->stream.write(this->buffer.data(), static_cast<std::streamsize>(this->used));
+                this->used = 0;
+            }
+
+            return static_cast<bool>(this->stream);
+        }
+    private:
+        std::ostream& stream;
+        std::vector<char> buffer;
+        usize used;
+    };
+} // namespace gpx
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef _GRAPHEXIA_COARSENING__HPP_
+#define _GRAPHEXIA_COARSENING__HPP_
+
+#include <Graphexia/Graph.hpp>
+#include <Graphexia/GraphCSR.hpp>
+
+#include <stop_token>
+#include <vector>
+
+namespace gpx {
+    // One level of a coarsening hierarchy. The CSR keeps both directions of every edge and no edge ids, parallel
+    // edges merged by coarsening are a single entry weighted by how many original edges it stands for.
+    struct CoarseningLevel {
+        GraphCSR csr;
+        std::vector<f32> entryWeights;
+        // Original vertices collapsed into every vertex
+        std::vector<f32> vertexWeights;
+        // Vertex of the next coarser level containing every vertex of this one, empty for the coarsest level
+        std::vector<usize> parents;
+    };
+
+    struct CoarseningOptions {
+        // Stop once a level has at most this many vertices...
+        usize minimumVertices = 64;
+        // ...or when coarsening keeps more than this fraction of them (e.g. mostly isolated vertices left)
+        f64 maximumRatio = 0.8;
+        usize maxLevels = 32;
+        // 0 means all hardware threads
+        usize threads = 0;
+        // Order in which vertices pick their match
+        u64 seed = 0;
+        // Checked before every level, a stopped hierarchy is just shallower
+        std::stop_token stop;
+    };
+
+    // Levels go from the original graph (0) to the coarsest one. Every level is built by heavy edge matching, preferring
+    // the edge whose endpoints collapse the fewest original vertices, then vertices left unmatched join their lightest
+    // neighbour, which collapses stars that matching alone would only shrink by one leaf per level.
+    //
+    // Meant to be built once and reused: multilevel layouts walk it down, level of detail rendering can draw any level
+    // and place every coarse vertex at the mean of the vertices it contains.
+    struct CoarseningHierarchy {
+        std::vector<CoarseningLevel> levels;
+
+        usize Levels() const { return this->levels.size(); }
+        const CoarseningLevel& Level(usize level) const { return this->levels[level]; }
+        const CoarseningLevel& Coarsest() const { return this->levels.back(); }
+
+        // Vertex of 'level' that contains 'vertex' of the original graph
+        usize Ancestor(usize vertex, usize level) const {
+            for (usize i = 0; i < level; ++i) {
+                vertex = this->levels[i].parents[vertex];
+            }
+
+            return vertex;
+        }
+    };
+
+    // The direction of the edges is ignored
+    CoarseningHierarchy CreateCoarseningHierarchy(const Graph& graph, const CoarseningOptions& options = {});
+    CoarseningHierarchy CreateCoarseningHierarchy(GraphCSR&& csr, const CoarseningOptions& options = {});
+} // namespace gpx
+
+#endif
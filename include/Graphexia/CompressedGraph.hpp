@@ -0,0 +1,105 @@
+#ifndef _GRAPHEXIA_COMPRESSEDGRAPH__HPP_
+#define _GRAPHEXIA_COMPRESSEDGRAPH__HPP_
+
+#include <Graphexia/Graph.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace gpx {
+    // Decodes 'count' Stream VByte values (2 bit length codes in 'control', bytes in 'data') into 'out', SIMD (SSSE3) when available.
+    // Returns the end of the consumed data. Reads up to 16 bytes past the last value, so data needs CompressedGraph::Padding extra bytes.
+    const u8* DecodeStreamVByte(const u8* control, const u8* data, u32* out, usize count);
+
+    // Read only adjacency in the spirit of WebGraph, for graphs that don't fit in RAM otherwise. Every neighbour list is sorted and gap
+    // encoded: the first neighbour relative to the vertex itself (zig-zag), the rest as the difference to the previous one. The gaps are
+    // Stream VByte packed (control bytes first, then 1-4 data bytes per gap) so they decode several at a time.
+    //
+    // Edge ids and weights are not kept, ForEachAdjacent passes NoEdge. Models AdjacencyGraph, so BFS/DFS iterate the compressed lists.
+    struct CompressedGraph final {
+        static constexpr usize NoEdge = std::numeric_limits<usize>::max();
+        // Only every CheckpointInterval-th vertex stores where its list starts, the ones in between are reached by skipping lists
+        static constexpr usize CheckpointInterval = 32;
+        static constexpr usize Padding = 16;
+
+        usize Vertices() const { return this->vertices; }
+        usize Entries() const { return this->entries; }
+        bool IsDirected() const { return this->directed; }
+
+        usize Degree(usize id) const;
+
+        // Total size in bytes and per adjacency entry in bits
+        usize SizeInBytes() const { return this->data.size() + this->checkpoints.size() * sizeof(u64); }
+        f64 BitsPerEntry() const { return this->entries ? 8.0 * f64(this->SizeInBytes()) / f64(this->entries) : 0.0; }
+
+        template<typename Function>
+        void ForEachAdjacent(usize id, Function&& function) const {
+            constexpr usize Batch = 128;
+            u32 gaps[Batch];
+
+            const u8* block = this->Block(id);
+            usize degree = ReadVarint(block);
+            const u8* control = block;
+            const u8* values = block + (degree + 3) / 4;
+
+            usize previous = id;
+            for (usize done = 0; done < degree; done += Batch) {
+                usize count = std::min(Batch, degree - done);
+                values = DecodeStreamVByte(control + done / 4, values, gaps, count);
+
+                usize i = 0;
+                if(done == 0) { // Zig-zag offset from the vertex itself
+                    u32 first = gaps[0];
+                    previous = (first & 1) ? id - ((static_cast<usize>(first) + 1) >> 1) : id + (first >> 1);
+                    function(previous, NoEdge);
+                    i = 1;
+                }
+
+                for (; i < count; ++i) {
+                    previous += gaps[i];
+                    function(previous, NoEdge);
+                }
+            }
+        }
+
+        // Plain neighbour list of a vertex, in increasing order
+        std::vector<usize> Adjacent(usize id) const;
+
+        // Encoded lists of every vertex, back to back
+        const std::vector<u8>& Data() const { return this->data; }
+        const std::vector<u64>& Checkpoints() const { return this->checkpoints; }
+
+        // LEB128, 7 bits per byte
+        static usize ReadVarint(const u8*& cursor) {
+            usize value = 0;
+
+            for (usize shift = 0;; shift += 7) {
+                u8 byte = *cursor++;
+                value |= static_cast<usize>(byte & 0x7F) << shift;
+
+                if(!(byte & 0x80)) {
+                    return value;
+                }
+            }
+        }
+
+        friend std::optional<CompressedGraph> CompressGraph(const Graph& graph, usize threads);
+    private:
+        // Start of the encoded list of 'id'
+        const u8* Block(usize id) const;
+
+        usize vertices;
+        usize entries;
+        bool directed;
+        std::vector<u64> checkpoints;
+        std::vector<u8> data;
+    };
+
+    // Outgoing adjacency (both directions when undirected) of the graph, built in parallel.
+    // Nothing is returned for graphs with 2^31 vertices or more, gaps are stored in 32 bits.
+    std::optional<CompressedGraph> CompressGraph(const Graph& graph, usize threads = 0);
+} // namespace gpx
+
+#endif
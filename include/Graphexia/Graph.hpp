@@ -19,14 +19,16 @@ namespace gpx {
         constexpr explicit Graph(usize vertices)
             : vertices(vertices), edges(), edgesForVertex(std::vector<std::vector<usize>>(vertices)), directed() {}
 
-        constexpr explicit Graph(usize vertices, std::span<Edge> edges)
-            : vertices(vertices), edges(std::vector<Edge>(edges.size())), edgesForVertex(std::vector<std::vector<usize>>(vertices)), directed() {
-            for (usize i = 0; i < edges.size(); ++i) {
-                const Edge& edge = edges[i];
+        explicit Graph(usize vertices, std::span<Edge> edges)
+            : Graph(vertices, std::vector<Edge>(edges.begin(), edges.end())) {}
 
-                assert(edge.fromId < vertices && edge.toId < vertices);
-                this->edges[i] = edge;
-            }
+        // Bulk construction, the adjacency of every vertex is allocated once with its exact size
+        explicit Graph(usize vertices, std::vector<Edge>&& edges);
+
+        // Adjacency already built by the caller (e.g. structured generators), edgesForVertex[v] must hold the ids of every edge touching v in increasing order
+        explicit Graph(usize vertices, std::vector<Edge>&& edges, std::vector<std::vector<usize>>&& edgesForVertex)
+            : vertices(vertices), edges(std::move(edges)), edgesForVertex(std::move(edgesForVertex)), directed() {
+            assert(this->edgesForVertex.size() == vertices);
         }
 
         bool IsDirected() const { return this->directed; }
@@ -55,6 +57,25 @@ namespace gpx {
 
         f32& EdgeWeight(usize id) { return this->edges[id].weight; }
 
+        // Calls function(adjacentVertex, edgeId) for every edge that can be used to leave 'id', in increasing edge id order (AdjacencyGraph)
+        template<typename Function>
+        void ForEachAdjacent(usize id, Function&& function) const {
+            const std::vector<usize>& vEdges = this->edgesForVertex[id];
+
+            for (usize i = 0; i < vEdges.size(); ++i) {
+                usize edgeId = vEdges[i];
+                const Edge& edge = this->edges[edgeId];
+
+                if(edge.toId != id) {
+                    function(edge.toId, edgeId);
+                } else if(!this->directed) {
+                    function(edge.fromId, edgeId);
+                } else if(edge.fromId == id && (i == 0 || vEdges[i - 1] != edgeId)) { // A directed loop is listed twice but leaves once, like in CreateCSR
+                    function(id, edgeId);
+                }
+            }
+        }
+
         usize Vertices() const { return this->vertices; }
         const std::vector<Edge>& Edges() const { return this->edges; }
         const std::vector<usize>& EdgesForVertex(usize id) const { return this->edgesForVertex[id]; }
@@ -0,0 +1,39 @@
+#ifndef _GRAPHEXIA_GRAPHCSR__HPP_
+#define _GRAPHEXIA_GRAPHCSR__HPP_
+
+#include <Graphexia/Graph.hpp>
+
+#include <span>
+#include <vector>
+
+namespace gpx {
+    enum class CSRDirection : u8 {
+        Outgoing,
+        Incoming,
+        // Ignore the direction of the graph, every edge is stored in both directions
+        Both
+    };
+
+    // Compressed sparse row view of the adjacency of a Graph, the neighbours of vertex i are adjacent[offsets[i]..offsets[i + 1]).
+    // Undirected graphs store every edge in both directions (loops twice, matching EdgesForVertex), so the direction is irrelevant for them.
+    struct GraphCSR final {
+        std::vector<usize> offsets;
+        std::vector<usize> adjacent;
+        std::vector<usize> edgeIds;
+
+        usize Vertices() const { return this->offsets.empty() ? 0 : this->offsets.size() - 1; }
+        usize Entries() const { return this->adjacent.size(); }
+        usize Degree(usize id) const { return this->offsets[id + 1] - this->offsets[id]; }
+
+        std::span<const usize> Adjacent(usize id) const { return std::span<const usize>(this->adjacent.data() + this->offsets[id], this->Degree(id)); }
+        std::span<const usize> AdjacentEdges(usize id) const { return std::span<const usize>(this->edgeIds.data() + this->offsets[id], this->Degree(id)); }
+    };
+
+    GraphCSR CreateCSR(const Graph& graph, CSRDirection direction = CSRDirection::Outgoing);
+
+    // Splits the vertices of the CSR in at most 'parts' contiguous ranges with roughly the same amount of entries each.
+    // Returns the bounds of every range, suitable for ParallelForChunks.
+    std::vector<usize> BalancedBounds(const GraphCSR& csr, usize parts);
+} // namespace gpx
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef _GRAPHEXIA_GRAPHCONCEPT__HPP_
+#define _GRAPHEXIA_GRAPHCONCEPT__HPP_
+
+#include <Graphexia/Core.hpp>
+
+#include <concepts>
+
+namespace gpx {
+    // What traversal algorithms need from a graph: vertices are [0, Vertices()) and ForEachAdjacent(v, function) calls
+    // function(adjacentVertex, edgeId) for every edge that can be used to leave v. gpx::Graph is a model, the implicit
+    // graphs in ImplicitGraph.hpp compute their adjacency on the fly instead.
+    template<typename T>
+    concept AdjacencyGraph = requires(const T& graph, usize vertex, void (*function)(usize, usize)) {
+        { graph.Vertices() } -> std::convertible_to<usize>;
+        { graph.IsDirected() } -> std::convertible_to<bool>;
+        graph.ForEachAdjacent(vertex, function);
+    };
+} // namespace gpx
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef _GRAPHEXIA_GRAPHEXPORT__HPP_
+#define _GRAPHEXIA_GRAPHEXPORT__HPP_
+
+#include <Graphexia/Graph.hpp>
+#include <Graphexia/VertexAttributes.hpp>
+
+#include <ostream>
+
+namespace gpx {
+    // Text exporters, they stream through a BufferedSink so memory stays bounded whatever the size of the graph.
+    // Positions and labels are written when the attributes have them, weights only when they are not 0.
+    // Return false if the stream failed.
+
+    // Graphviz DOT, positions as pos="x,y!" (pinned, for neato -n / fdp)
+    bool ExportDOT(std::ostream& stream, const Graph& graph, const VertexAttributes& attributes = VertexAttributes());
+    // GraphML with 'label', 'x', 'y' node keys and a 'weight' edge key
+    bool ExportGraphML(std::ostream& stream, const Graph& graph, const VertexAttributes& attributes = VertexAttributes());
+    // "from to [weight]" per line after a '#' header, readable by ParseEdgeList
+    bool ExportEdgeList(std::ostream& stream, const Graph& graph, bool weights = true);
+} // namespace gpx
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef _GRAPHEXIA_GRAPHFILE__HPP_
+#define _GRAPHEXIA_GRAPHFILE__HPP_
+
+#include <Graphexia/Graph.hpp>
+#include <Graphexia/MappedFile.hpp>
+#include <Graphexia/VertexAttributes.hpp>
+
+#include <array>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace gpx {
+    // Binary graph file (.gpxg), little endian. Everything after the header is a section aligned to GraphFileAlignment bytes
+    // so it can be used in place once mapped:
+    //   Offsets      u64[vertices + 1]   CSR of the outgoing adjacency (both directions when undirected, loops twice)
+    //   Adjacent     u64[entries]
+    //   EdgeIds      u64[entries]
+    //   Endpoints    u64[2 * edges]      (from, to) of every edge
+    //   Weights      f32[edges]
+    //   Positions    f32[2 * vertices]   (x, y), optional
+    //   LabelOffsets u64[vertices + 1]   label of v is LabelData[LabelOffsets[v]..LabelOffsets[v + 1]), optional
+    //   LabelData    u8[]
+    //   VertexColors u32[vertices]       0xRRGGBBAA, optional
+    //   EdgeColors   u32[edges]          0xRRGGBBAA, optional
+    // Readers must reject any version they don't know, new sections are only appended after bumping it.
+    constexpr std::array<char, 8> GraphFileMagic = {'G', 'P', 'X', 'G', 'R', 'A', 'P', 'H'};
+    constexpr u32 GraphFileVersion = 2;
+    constexpr u64 GraphFileAlignment = 64;
+
+    enum class GraphFileFlags : u32 {
+        None = 0,
+        Directed = 1 << 0,
+        Positions = 1 << 1,
+        Labels = 1 << 2,
+        VertexColors = 1 << 3,
+        EdgeColors = 1 << 4,
+    };
+
+    inline GraphFileFlags operator|(GraphFileFlags a, GraphFileFlags b) { return static_cast<GraphFileFlags>(static_cast<u32>(a) | static_cast<u32>(b)); }
+    inline GraphFileFlags operator&(GraphFileFlags a, GraphFileFlags b) { return static_cast<GraphFileFlags>(static_cast<u32>(a) & static_cast<u32>(b)); }
+
+    enum class GraphFileSection : u8 {
+        Offsets,
+        Adjacent,
+        EdgeIds,
+        Endpoints,
+        Weights,
+        Positions,
+        LabelOffsets,
+        LabelData,
+        VertexColors,
+        EdgeColors,
+        Count
+    };
+
+    // Byte range of a section, from the start of the file. Missing sections are empty.
+    struct GraphFileRange {
+        u64 offset;
+        u64 size;
+    };
+
+    struct GraphFileHeader {
+        std::array<char, 8> magic;
+        u32 version;
+        GraphFileFlags flags;
+        u64 vertices;
+        u64 edges;
+        u64 entries;
+        std::array<GraphFileRange, static_cast<usize>(GraphFileSection::Count)> sections;
+    };
+
+    bool WriteGraphFile(const std::filesystem::path& path, const Graph& graph, const VertexAttributes& attributes = VertexAttributes(), const EdgeAttributes& edgeAttributes = EdgeAttributes());
+
+    // A .gpxg file mapped in memory, opening only checks the header so it doesn't depend on the size of the graph.
+    // Every accessor reads straight from the mapping and it models AdjacencyGraph, so traversals run over the file itself.
+    struct MappedGraph final {
+        static std::optional<MappedGraph> Open(const std::filesystem::path& path);
+
+        usize Vertices() const { return static_cast<usize>(this->header->vertices); }
+        usize EdgeCount() const { return static_cast<usize>(this->header->edges); }
+        bool IsDirected() const { return (this->header->flags & GraphFileFlags::Directed) != GraphFileFlags::None; }
+        bool HasPositions() const { return !this->positions.empty(); }
+        bool HasLabels() const { return !this->labelOffsets.empty(); }
+        bool HasVertexColors() const { return !this->vertexColors.empty(); }
+        bool HasEdgeColors() const { return !this->edgeColors.empty(); }
+
+        std::span<const u64> Offsets() const { return this->offsets; }
+        std::span<const u64> Adjacent() const { return this->adjacent; }
+        std::span<const u64> EdgeIds() const { return this->edgeIds; }
+        std::span<const u64> Endpoints() const { return this->endpoints; }
+        std::span<const f32> Weights() const { return this->weights; }
+        std::span<const f32> Positions() const { return this->positions; }
+        std::span<const u32> VertexColors() const { return this->vertexColors; }
+        std::span<const u32> EdgeColors() const { return this->edgeColors; }
+
+        usize Degree(usize id) const { return static_cast<usize>(this->offsets[id + 1] - this->offsets[id]); }
+        Edge EdgeAt(usize id) const { return Edge{static_cast<usize>(this->endpoints[2 * id]), static_cast<usize>(this->endpoints[2 * id + 1]), this->weights[id]}; }
+        std::string_view Label(usize id) const;
+
+        template<typename Function>
+        void ForEachAdjacent(usize id, Function&& function) const {
+            for (u64 i = this->offsets[id]; i < this->offsets[id + 1]; ++i) {
+                function(static_cast<usize>(this->adjacent[i]), static_cast<usize>(this->edgeIds[i]));
+            }
+        }
+
+        // Full O(V + E) check of the arrays (monotonic offsets, ids in range...), Open trusts them
+        bool Validate() const;
+
+        // Copies everything into a regular Graph (e.g. to edit it)
+        Graph ToGraph() const;
+    private:
+        MappedGraph(MappedFile&& file)
+            : file(std::move(file)), header(), offsets(), adjacent(), edgeIds(), endpoints(), weights(), positions(), labelOffsets(), labelData(), vertexColors(), edgeColors() {}
+
+        MappedFile file;
+        const GraphFileHeader* header;
+
+        std::span<const u64> offsets, adjacent, edgeIds, endpoints;
+        std::span<const f32> weights, positions;
+        std::span<const u64> labelOffsets;
+        std::span<const char> labelData;
+        std::span<const u32> vertexColors, edgeColors;
+    };
+} // namespace gpx
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef _GRAPHEXIA_GRAPHIMPORT__HPP_
+#define _GRAPHEXIA_GRAPHIMPORT__HPP_
+
+#include <Graphexia/Graph.hpp>
+
+#include <filesystem>
+#include <optional>
+#include <string_view>
+
+namespace gpx {
+    // Text graph formats. The input is split in newline aligned chunks which are parsed in parallel with std::from_chars,
+    // every chunk into its own edge list, and the lists are concatenated in file order into the bulk Graph constructor.
+    // The result doesn't depend on the thread count. Malformed input returns nothing.
+    // Load* map the file and parse it in place, Parse* work on text already in memory.
+
+    // SNAP style edge list: "from to [weight]" per line, '#' and '%' start comments. Ids start at 0, the graph gets (max id + 1) vertices.
+    std::optional<Graph> ParseEdgeList(std::string_view text, bool directed = true, usize threads = 0);
+    // DIMACS: "p <problem> n m" then 1-based "a u v [w]" arcs or "e u v [w]" edges, 'c' comments and 'n' designators are skipped.
+    // Edge problems (edge, col, clq) are undirected, everything else (sp, max, min...) directed.
+    std::optional<Graph> ParseDIMACS(std::string_view text, usize threads = 0);
+    // METIS: "n m [fmt [ncon]]" then the 1-based adjacency of vertex i on the i-th line (with vertex sizes / weights / edge weights
+    // depending on fmt), '%' comments. Every edge is listed by both endpoints and kept once.
+    std::optional<Graph> ParseMETIS(std::string_view text, usize threads = 0);
+    // MatrixMarket coordinate matrix: every nonzero (i, j) is an edge from i - 1 to j - 1 weighted by its (real part) value.
+    // 'general' matrices are directed, symmetric / skew-symmetric / hermitian ones undirected.
+    std::optional<Graph> ParseMatrixMarket(std::string_view text, usize threads = 0);
+
+    std::optional<Graph> LoadEdgeList(const std::filesystem::path& path, bool directed = true, usize threads = 0);
+    std::optional<Graph> LoadDIMACS(const std::filesystem::path& path, usize threads = 0);
+    std::optional<Graph> LoadMETIS(const std::filesystem::path& path, usize threads = 0);
+    std::optional<Graph> LoadMatrixMarket(const std::filesystem::path& path, usize threads = 0);
+} // namespace gpx
+
+#endif
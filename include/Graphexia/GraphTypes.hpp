@@ -4,7 +4,33 @@
 #include <Graphexia/Graph.hpp>
 
 namespace gpx {
-    Graph CreateKComplete(usize k);
+    // Structured generators materialize the graphs of ImplicitGraph.hpp, every edge and adjacency list is computed by index arithmetic
+    // and filled in parallel (threads = 0 uses every core)
+
+    Graph CreateKComplete(usize k, usize threads = 0);
+    // Vertices [0, left) joined to every vertex in [left, left + right)
+    Graph CreateCompleteBipartite(usize left, usize right, usize threads = 0);
+    // 2^dimensions vertices, joined when their ids differ in exactly one bit
+    Graph CreateHypercube(usize dimensions, usize threads = 0);
+    // width x height lattice, vertex (x, y) has id y * width + x
+    Graph CreateGrid(usize width, usize height, usize threads = 0);
+    // Same as the grid but the borders wrap around (only along dimensions bigger than 2, otherwise they would be parallel edges)
+    Graph CreateTorus(usize width, usize height, usize threads = 0);
+
+    // Random generators use CounterRandom, the same seed always produces the same graph whatever the thread count is.
+
+    // Erdős–Rényi G(n, p), geometric skips over the non edges so it runs in O(n + m) instead of O(n^2).
+    // Rows are split in fixed blocks of pairs with their own random stream and generated in parallel.
+    Graph CreateGnp(usize n, f64 p, u64 seed = 0, bool directed = false, usize threads = 0);
+    // Erdős–Rényi G(n, m), exactly m distinct edges chosen uniformly
+    Graph CreateGnm(usize n, usize m, u64 seed = 0, bool directed = false);
+    // Barabási–Albert preferential attachment, every new vertex attaches to m distinct existing vertices
+    Graph CreateBarabasiAlbert(usize n, usize m, u64 seed = 0);
+    // Watts–Strogatz small world: ring lattice where every vertex is joined to its k nearest neighbours, then every edge is rewired with probability beta
+    Graph CreateWattsStrogatz(usize n, usize k, f64 beta, u64 seed = 0);
+    // R-MAT (recursive Kronecker) directed graph with 2^scale vertices and 'edges' edges, d = 1 - a - b - c.
+    // Loops and parallel edges are kept, as usual in R-MAT benchmarks.
+    Graph CreateRMAT(usize scale, usize edges, f64 a = 0.57, f64 b = 0.19, f64 c = 0.19, u64 seed = 0, usize threads = 0);
 } // namespace gpx
 
 #endif
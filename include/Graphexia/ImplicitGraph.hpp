@@ -0,0 +1,189 @@
+#ifndef _GRAPHEXIA_IMPLICITGRAPH__HPP_
+#define _GRAPHEXIA_IMPLICITGRAPH__HPP_
+
+#include <Graphexia/Graph.hpp>
+#include <Graphexia/GraphConcept.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace gpx {
+    // Structured graphs that are never stored, every adjacency is computed when asked for. They only take a few bytes whatever their size.
+    // Edge ids are the same ones the Create* generators in GraphTypes.hpp use (they are built from these), and ForEachAdjacent
+    // always goes in increasing edge id order.
+
+    // K_k, edges (i, j) with i < j in lexicographic order
+    struct ImplicitCompleteGraph final {
+        usize k;
+
+        usize Vertices() const { return this->k; }
+        usize EdgeCount() const { return this->k * (this->k - (this->k != 0)) / 2; }
+        usize Degree(usize) const { return this->k - 1; }
+        bool IsDirected() const { return false; }
+
+        // The edges of i start here
+        usize FirstEdge(usize i) const { return i * this->k - i * (i + 1) / 2; }
+
+        Edge EdgeAt(usize id) const {
+            // Rows have different lengths, binary search the row
+            usize low = 0, high = this->k - 1;
+
+            while(low + 1 < high) {
+                usize middle = low + (high - low) / 2;
+
+                if(this->FirstEdge(middle) <= id) {
+                    low = middle;
+                } else {
+                    high = middle;
+                }
+            }
+
+            return Edge{low, low + 1 + (id - this->FirstEdge(low)), 0};
+        }
+
+        template<typename Function>
+        void ForEachAdjacent(usize v, Function&& function) const {
+            for (usize i = 0; i < v; ++i) {
+                function(i, this->FirstEdge(i) + (v - i - 1));
+            }
+
+            usize first = this->FirstEdge(v);
+            for (usize j = v + 1; j < this->k; ++j) {
+                function(j, first + (j - v - 1));
+            }
+        }
+    };
+
+    // Vertices [0, left) joined to every vertex in [left, left + right), edge (i, left + j) has id i * right + j
+    struct ImplicitCompleteBipartiteGraph final {
+        usize left, right;
+
+        usize Vertices() const { return this->left + this->right; }
+        usize EdgeCount() const { return this->left * this->right; }
+        usize Degree(usize v) const { return v < this->left ? this->right : this->left; }
+        bool IsDirected() const { return false; }
+
+        Edge EdgeAt(usize id) const { return Edge{id / this->right, this->left + id % this->right, 0}; }
+
+        template<typename Function>
+        void ForEachAdjacent(usize v, Function&& function) const {
+            if(v < this->left) {
+                for (usize j = 0; j < this->right; ++j) {
+                    function(this->left + j, v * this->right + j);
+                }
+            } else {
+                for (usize i = 0; i < this->left; ++i) {
+                    function(i, i * this->right + (v - this->left));
+                }
+            }
+        }
+    };
+
+    // 2^dimensions vertices joined when they differ in one bit. Edges are grouped by bit, (v, v | 1 << b) for every v without b
+    // in increasing order, so dropping bit b from v gives its position inside the group.
+    struct ImplicitHypercubeGraph final {
+        usize dimensions;
+
+        usize Vertices() const { return usize(1) << this->dimensions; }
+        usize EdgeCount() const { return this->dimensions * (this->Vertices() >> 1); }
+        usize Degree(usize) const { return this->dimensions; }
+        bool IsDirected() const { return false; }
+
+        Edge EdgeAt(usize id) const {
+            usize half = this->Vertices() >> 1;
+            usize b = id / half, index = id % half;
+            usize v = ((index >> b) << (b + 1)) | (index & ((usize(1) << b) - 1));
+
+            return Edge{v, v | (usize(1) << b), 0};
+        }
+
+        template<typename Function>
+        void ForEachAdjacent(usize v, Function&& function) const {
+            usize half = this->Vertices() >> 1;
+
+            for (usize b = 0; b < this->dimensions; ++b) {
+                usize position = ((v >> (b + 1)) << b) | (v & ((usize(1) << b) - 1));
+                function(v ^ (usize(1) << b), b * half + position);
+            }
+        }
+    };
+
+    // width x height lattice, vertex (x, y) has id y * width + x. With wrap the borders are joined (torus) along dimensions
+    // bigger than 2. Horizontal edges go first row by row, then the vertical ones; wrapping edges are the last of their row / the last row.
+    struct ImplicitGridGraph final {
+        usize width, height;
+        bool wrap;
+
+        bool WrapsX() const { return this->wrap && this->width > 2; }
+        bool WrapsY() const { return this->wrap && this->height > 2; }
+        usize RowEdges() const { return this->WrapsX() ? this->width : this->width - (this->width != 0); }
+        usize ColumnRows() const { return this->WrapsY() ? this->height : this->height - (this->height != 0); }
+        usize HorizontalEdges() const { return this->RowEdges() * this->height; }
+
+        usize Vertices() const { return this->width * this->height; }
+        usize EdgeCount() const { return this->HorizontalEdges() + this->width * this->ColumnRows(); }
+        bool IsDirected() const { return false; }
+
+        Edge EdgeAt(usize id) const {
+            usize horizontal = this->HorizontalEdges();
+
+            if(id < horizontal) {
+                usize y = id / this->RowEdges(), x = id % this->RowEdges();
+                return Edge{y * this->width + x, y * this->width + (x + 1) % this->width, 0};
+            }
+
+            id -= horizontal;
+            usize y = id / this->width, x = id % this->width;
+            return Edge{y * this->width + x, ((y + 1) % this->height) * this->width + x, 0};
+        }
+
+        template<typename Function>
+        void ForEachAdjacent(usize v, Function&& function) const {
+            usize y = v / this->width, x = v % this->width;
+            usize rowEdges = this->RowEdges(), horizontal = this->HorizontalEdges();
+
+            // (Edge id, adjacent vertex), at most 4 of them
+            std::pair<usize, usize> adjacent[4];
+            usize count = 0;
+
+            if(x > 0) {
+                adjacent[count++] = {y * rowEdges + x - 1, v - 1};
+            } else if(this->WrapsX()) {
+                adjacent[count++] = {y * rowEdges + this->width - 1, v + this->width - 1};
+            }
+
+            if(x < rowEdges) {
+                adjacent[count++] = {y * rowEdges + x, x + 1 < this->width ? v + 1 : v + 1 - this->width};
+            }
+
+            if(y > 0) {
+                adjacent[count++] = {horizontal + (y - 1) * this->width + x, v - this->width};
+            } else if(this->WrapsY()) {
+                adjacent[count++] = {horizontal + (this->height - 1) * this->width + x, (this->height - 1) * this->width + x};
+            }
+
+            if(y < this->ColumnRows()) {
+                adjacent[count++] = {horizontal + y * this->width + x, y + 1 < this->height ? v + this->width : x};
+            }
+
+            std::sort(adjacent, adjacent + count);
+            for (usize i = 0; i < count; ++i) {
+                function(adjacent[i].second, adjacent[i].first);
+            }
+        }
+
+        usize Degree(usize v) const {
+            usize degree = 0;
+            this->ForEachAdjacent(v, [&degree](usize, usize) { ++degree; });
+            return degree;
+        }
+    };
+
+    static_assert(AdjacencyGraph<Graph>);
+    static_assert(AdjacencyGraph<ImplicitCompleteGraph>);
+    static_assert(AdjacencyGraph<ImplicitCompleteBipartiteGraph>);
+    static_assert(AdjacencyGraph<ImplicitHypercubeGraph>);
+    static_assert(AdjacencyGraph<ImplicitGridGraph>);
+} // namespace gpx
+
+#endif
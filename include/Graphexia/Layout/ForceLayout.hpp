@@ -0,0 +1,85 @@
+#ifndef _GRAPHEXIA_LAYOUT_FORCELAYOUT__HPP_
+#define _GRAPHEXIA_LAYOUT_FORCELAYOUT__HPP_
+
+#include <Graphexia/Graph.hpp>
+#include <Graphexia/GraphCSR.hpp>
+
+#include <span>
+#include <vector>
+
+namespace gpx {
+    enum class ForceModel : u8 {
+        // Repulsion k^2 / d, attraction d^2 / k, cooled with a temperature that decreases linearly to 0
+        FruchtermanReingold,
+        // Repulsion scaling * (deg(u) + 1) * (deg(v) + 1) / d, attraction d, with adaptive per vertex speeds (Jacomy et al. 2014)
+        ForceAtlas2
+    };
+
+    struct ForceLayoutOptions {
+        ForceModel model = ForceModel::ForceAtlas2;
+        // Barnes-Hut opening criterion, a cell of side s at distance d is approximated by its center of mass when s < theta * d
+        f32 theta = 1.2f;
+        // ForceAtlas2 repulsion strength or Fruchterman-Reingold ideal edge length
+        f32 scaling = 2.f;
+        // Pull towards the origin, keeps disconnected components from drifting away
+        f32 gravity = 1.f;
+        usize maxIterations = 1000;
+        // Iteration stops when the mean displacement of a step is below this
+        f32 tolerance = 0.01f;
+        // 0 means all hardware threads
+        usize threads = 0;
+        // Initial positions when none are given
+        u64 seed = 0;
+    };
+
+    // Node of the Barnes-Hut quadtree, which is rebuilt every iteration over the vertices sorted in Morton order.
+    // Points of the cell are [begin, end) of that order, children are contiguous. Leaves have no children.
+    struct ForceLayoutCell {
+        f32 x, y;
+        f32 mass;
+        f32 size;
+        u32 begin, end;
+        u32 children, childCount;
+    };
+
+    // Positions are kept as separate x / y arrays so forces accumulate over contiguous lanes
+    struct ForceLayoutState {
+        ForceLayoutOptions options;
+        GraphCSR csr;
+        // deg + 1 for ForceAtlas2, 1 for Fruchterman-Reingold (weighted degree + vertex weight / vertex weight when weighted)
+        std::vector<f32> masses;
+        // Attraction multiplier of every csr entry, empty when all of them are 1
+        std::vector<f32> weights;
+        std::vector<usize> bounds;
+
+        std::vector<f32> x, y;
+        std::vector<f32> forceX, forceY;
+        // ForceAtlas2 needs the forces of the previous iteration to measure the swinging of every vertex
+        std::vector<f32> previousForceX, previousForceY;
+
+        // Morton order of the vertices and the positions / masses in that order
+        std::vector<u64> keys;
+        std::vector<u32> order;
+        std::vector<f32> sortedX, sortedY, sortedMasses;
+        std::vector<ForceLayoutCell> cells;
+
+        f32 temperature;
+        f32 speed;
+        f32 displacement;
+        usize iteration;
+    };
+
+    // The direction of the edges is ignored. Positions are (x, y) per vertex, random ones are used when empty.
+    ForceLayoutState SetupForceLayout(const Graph& graph, const ForceLayoutOptions& options = {}, std::span<const f32> positions = {});
+    ForceLayoutState SetupForceLayout(GraphCSR&& csr, const ForceLayoutOptions& options = {}, std::span<const f32> positions = {});
+    // Weighted graph, e.g. a coarsening level: entry i of the csr pulls weights[i] times as hard and vertex v stands for
+    // vertexWeights[v] vertices, so the unweighted layout is the one with every weight 1
+    ForceLayoutState SetupForceLayout(GraphCSR&& csr, std::vector<f32>&& weights, std::span<const f32> vertexWeights, const ForceLayoutOptions& options = {}, std::span<const f32> positions = {});
+    // Moves every vertex once, returns true when the layout settled (or ran out of iterations)
+    bool IterateForceLayout(ForceLayoutState& state);
+
+    // Runs it to the end, (x, y) per vertex
+    std::vector<f32> ForceLayout(const Graph& graph, const ForceLayoutOptions& options = {}, std::span<const f32> positions = {});
+} // namespace gpx
+
+#endif
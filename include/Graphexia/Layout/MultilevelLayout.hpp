@@ -0,0 +1,43 @@
+#ifndef _GRAPHEXIA_LAYOUT_MULTILEVELLAYOUT__HPP_
+#define _GRAPHEXIA_LAYOUT_MULTILEVELLAYOUT__HPP_
+
+#include <Graphexia/Coarsening.hpp>
+#include <Graphexia/Graph.hpp>
+#include <Graphexia/Layout/ForceLayout.hpp>
+
+#include <span>
+#include <vector>
+
+namespace gpx {
+    struct MultilevelLayoutOptions {
+        // Model, scaling, threads... of every level. maxIterations only applies to the coarsest one.
+        ForceLayoutOptions force;
+        CoarseningOptions coarsening;
+        // Iterations spent refining every finer level, the interpolated positions are already close
+        usize refineIterations = 40;
+    };
+
+    struct MultilevelLayoutState {
+        MultilevelLayoutOptions options;
+        CoarseningHierarchy hierarchy;
+        // Level being laid out, counts down to 0 (the original graph)
+        usize level;
+        ForceLayoutState force;
+    };
+
+    MultilevelLayoutState SetupMultilevelLayout(CoarseningHierarchy&& hierarchy, const MultilevelLayoutOptions& options = {});
+    MultilevelLayoutState SetupMultilevelLayout(const Graph& graph, const MultilevelLayoutOptions& options = {});
+    // Runs one force iteration of the current level, moving to the next finer one when it settles.
+    // Returns true when the original graph settled.
+    bool IterateMultilevelLayout(MultilevelLayoutState& state);
+    // Position of every original vertex, which is that of the coarse vertex containing it until level 0 is reached
+    void MultilevelLayoutPositions(const MultilevelLayoutState& state, std::span<f32> x, std::span<f32> y);
+
+    // Lays out the coarsest level from scratch, then walks the hierarchy down: every vertex starts next to its parent
+    // (scaled so the density stays the same) and a few force iterations untangle it. Most of the work happens on small graphs.
+    // Coarse vertices weigh as much as the vertices they collapse and merged edges pull as hard as all of them together.
+    std::vector<f32> MultilevelLayout(const CoarseningHierarchy& hierarchy, const MultilevelLayoutOptions& options = {});
+    std::vector<f32> MultilevelLayout(const Graph& graph, const MultilevelLayoutOptions& options = {});
+} // namespace gpx
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef _GRAPHEXIA_LAYOUT_SPECTRALLAYOUT__HPP_
+#define _GRAPHEXIA_LAYOUT_SPECTRALLAYOUT__HPP_
+
+#include <Graphexia/Graph.hpp>
+#include <Graphexia/GraphCSR.hpp>
+
+#include <stop_token>
+#include <vector>
+
+namespace gpx {
+    struct SpectralLayoutOptions {
+        // Mean edge length of the result
+        f32 scaling = 2.f;
+        // Every pair of vertices is joined by an edge of weight regularization * (mean degree) / n. Without it every connected
+        // component (and isolated vertex) is an eigenvector of its own and gets collapsed into a single point.
+        f64 regularization = 0.1;
+        // Vectors kept by Lanczos before restarting, memory is basisSize * Vertices() f64s
+        usize basisSize = 16;
+        // Iteration stops when the residual of both eigenvectors is below this...
+        f64 tolerance = 1e-3;
+        // ...or after this many matrix-vector products
+        usize maxIterations = 20000;
+        // 0 means all hardware threads
+        usize threads = 0;
+        // Starting vector of Lanczos
+        u64 seed = 0;
+        // Checked before every matrix-vector product, a stopped layout returns early with every vertex at the origin
+        std::stop_token stop;
+    };
+
+    struct SpectralLayoutResult {
+        // (x, y) per vertex
+        std::vector<f32> positions;
+        usize iterations;
+        bool converged;
+    };
+
+    // Places every vertex at its entries of the 2nd and 3rd smallest eigenvectors of the normalized Laplacian L x = mu D x
+    // (Koren, "Drawing graphs by eigenvectors"). They're computed as the largest ones of (I + D^-1/2 A D^-1/2) / 2 by thick restart
+    // Lanczos with full reorthogonalization, deflating the trivial eigenvector. The direction of the edges is ignored.
+    //
+    // Deterministic for a given seed and thread count, a good starting point for a force layout.
+    SpectralLayoutResult SpectralLayout(const Graph& graph, const SpectralLayoutOptions& options = {});
+    // Both directions of every edge must be in the CSR
+    SpectralLayoutResult SpectralLayout(const GraphCSR& csr, const SpectralLayoutOptions& options = {});
+} // namespace gpx
+
+#endif
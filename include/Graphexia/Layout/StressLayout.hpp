@@ -0,0 +1,65 @@
+#ifndef _GRAPHEXIA_LAYOUT_STRESSLAYOUT__HPP_
+#define _GRAPHEXIA_LAYOUT_STRESSLAYOUT__HPP_
+
+#include <Graphexia/Graph.hpp>
+#include <Graphexia/GraphCSR.hpp>
+
+#include <limits>
+#include <stop_token>
+#include <vector>
+
+namespace gpx {
+    struct StressLayoutOptions {
+        // Desired distance between adjacent vertices, any pair of vertices wants to be its BFS hops times this apart
+        f32 scaling = 2.f;
+        // Pivots of Pivot MDS, which are also the representatives of the sparse stress model. Memory is pivots * Vertices() u16s.
+        usize pivots = 32;
+        // Sparse stress majorization iterations refining Pivot MDS, 0 keeps Pivot MDS as is
+        usize maxIterations = 50;
+        // Iteration stops when the mean displacement of a step is below tolerance * scaling
+        f32 tolerance = 0.01f;
+        // 0 means all hardware threads
+        usize threads = 0;
+        // Picks the first pivot, the rest are the vertices farthest from the ones already picked
+        u64 seed = 0;
+        // Checked at every BFS level, a stopped setup returns early with every vertex at the origin
+        std::stop_token stop;
+    };
+
+    struct StressLayoutState {
+        static constexpr u16 NoHops = std::numeric_limits<u16>::max();
+
+        StressLayoutOptions options;
+        GraphCSR csr;
+        std::vector<usize> bounds;
+
+        std::vector<usize> pivots;
+        // BFS hops from every vertex to every pivot (vertex major, so a vertex reads one cache line), NoHops when unreachable.
+        // Longer paths are clamped to NoHops - 1.
+        std::vector<u16> hops;
+        // Region of a pivot: the vertices with no closer pivot. regionCounts[regionOffsets[p] + h] is how many vertices of the region
+        // of p are within h hops, pivot p stands for that many vertices in the stress of a vertex 2h hops away.
+        std::vector<usize> regionOffsets;
+        std::vector<u32> regionCounts;
+
+        std::vector<f32> x, y;
+        std::vector<f32> nextX, nextY;
+        f32 displacement;
+        usize iteration;
+    };
+
+    // Pivot MDS (Brandes and Pich, "Eigensolver methods for progressive multidimensional scaling of large data"): classical MDS
+    // restricted to the distances to a few pivots, which only needs one BFS per pivot and the eigenvectors of a pivots x pivots
+    // matrix. The direction of the edges is ignored and every edge has the same length.
+    StressLayoutState SetupStressLayout(const Graph& graph, const StressLayoutOptions& options = {});
+    StressLayoutState SetupStressLayout(GraphCSR&& csr, const StressLayoutOptions& options = {});
+    // One step of sparse stress majorization (Ortmann, Klimenta and Brandes, "A sparse stress model"): every vertex is pulled
+    // by its neighbours and by the pivots, weighted by how many vertices each pivot represents. O(V * pivots + E) per step.
+    // Returns true when the layout settled (or ran out of iterations).
+    bool IterateStressLayout(StressLayoutState& state);
+
+    // Runs it to the end, (x, y) per vertex
+    std::vector<f32> StressLayout(const Graph& graph, const StressLayoutOptions& options = {});
+} // namespace gpx
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef _GRAPHEXIA_MAPPEDFILE__HPP_
+#define _GRAPHEXIA_MAPPEDFILE__HPP_
+
+#include <Graphexia/Core.hpp>
+
+#include <filesystem>
+#include <optional>
+#include <span>
+
+namespace gpx {
+    // Read only memory map of a whole file, pages are loaded lazily by the OS when touched.
+    struct MappedFile final {
+        static std::optional<MappedFile> Open(const std::filesystem::path& path);
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+        ~MappedFile();
+
+        const u8* Data() const { return this->data; }
+        usize Size() const { return this->size; }
+        std::span<const u8> Bytes() const { return std::span<const u8>(this->data, this->size); }
+
+        // Hint that the file will be read front to back (parsers), only a hint so it may do nothing
+        void AdviseSequential() const;
+    private:
+        MappedFile(const u8* data, usize size, void* handle)
+            : data(data), size(size), handle(handle) {}
+
+        void Close();
+
+        const u8* data;
+        usize size;
+        // Mapping object on Windows, unused elsewhere
+        void* handle;
+    };
+} // namespace gpx
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef _GRAPHEXIA_PARALLEL__HPP_
+#define _GRAPHEXIA_PARALLEL__HPP_
+
+#include <Graphexia/Core.hpp>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+// Emscripten only has threads when built with -pthread
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+#define GRAPHEXIA_NO_THREADS
+#endif
+
+namespace gpx {
+    // Passing 0 threads to any parallel algorithm means 'use everything available'
+    inline usize ResolveThreads(usize threads) {
+#ifdef GRAPHEXIA_NO_THREADS
+        (void)threads;
+        return 1;
+#else
+        if(threads == 0) {
+            threads = std::thread::hardware_concurrency();
+        }
+
+        return std::max<usize>(threads, 1);
+#endif
+    }
+
+    // Splits [begin, end) in 'threads' contiguous chunks and calls function(chunkBegin, chunkEnd, threadIndex) for each one.
+    // The calling thread always processes the first chunk.
+    template<typename Function>
+    void ParallelFor(usize begin, usize end, usize threads, Function&& function, usize minimumChunk = 1024) {
+        if(begin >= end) {
+            return;
+        }
+
+        usize length = end - begin;
+        threads = std::min(ResolveThreads(threads), std::max<usize>(length / std::max<usize>(minimumChunk, 1), 1));
+
+        if(threads == 1) {
+            function(begin, end, 0);
+            return;
+        }
+
+#ifndef GRAPHEXIA_NO_THREADS
+        usize chunk = length / threads;
+        usize remainder = length % threads;
+
+        std::vector<std::jthread> workers;
+        workers.reserve(threads - 1);
+
+        usize chunkBegin = begin + chunk + (remainder > 0);
+        for (usize i = 1; i < threads; ++i) {
+            usize chunkEnd = chunkBegin + chunk + (i < remainder);
+
+            workers.emplace_back([&function, chunkBegin, chunkEnd, i]() { function(chunkBegin, chunkEnd, i); });
+            chunkBegin = chunkEnd;
+        }
+
+        function(begin, begin + chunk + (remainder > 0), 0);
+#endif
+    }
+
+    // Same as ParallelFor but the chunk bounds are given explicitly, bounds.size() - 1 chunks are processed.
+    template<typename Function>
+    void ParallelForChunks(const std::vector<usize>& bounds, Function&& function) {
+        if(bounds.size() < 2) {
+            return;
+        }
+
+        usize chunks = bounds.size() - 1;
+
+        if(chunks == 1) {
+            function(bounds[0], bounds[1], 0);
+            return;
+        }
+
+#ifdef GRAPHEXIA_NO_THREADS
+        for (usize i = 0; i < chunks; ++i) {
+            function(bounds[i], bounds[i + 1], i);
+        }
+#else
+        std::vector<std::jthread> workers;
+        workers.reserve(chunks - 1);
+
+        for (usize i = 1; i < chunks; ++i) {
+            workers.emplace_back([&function, &bounds, i]() { function(bounds[i], bounds[i + 1], i); });
+        }
+
+        function(bounds[0], bounds[1], 0);
+#endif
+    }
+
+    // Joins the parts in order into one vector, copying them in parallel. The parts are released as they are copied.
+    template<typename T>
+    std::vector<T> ParallelConcatenate(std::vector<std::vector<T>>& parts, usize threads) {
+        std::vector<usize> offsets(parts.size() + 1);
+        for (usize i = 0; i < parts.size(); ++i) {
+            offsets[i + 1] = offsets[i] + parts[i].size();
+        }
+
+        std::vector<T> joined(offsets.back());
+        ParallelFor(0, parts.size(), threads, [&](usize begin, usize end, usize) {
+            for (usize i = begin; i < end; ++i) {
+                std::copy(parts[i].begin(), parts[i].end(), joined.begin() + offsets[i]);
+                parts[i] = std::vector<T>();
+            }
+        }, 1);
+
+        return joined;
+    }
+} // namespace gpx
+
+#endif
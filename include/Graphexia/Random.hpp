@@ -0,0 +1,93 @@
+#ifndef _GRAPHEXIA_RANDOM__HPP_
+#define _GRAPHEXIA_RANDOM__HPP_
+
+#include <Graphexia/Core.hpp>
+
+#include <array>
+#include <limits>
+
+namespace gpx {
+    // Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3") of Lanes counters under the same key,
+    // counter[i][l] is word i of the l-th counter. Written lane by lane so the rounds vectorize when computing many blocks at once.
+    template<usize Lanes>
+    constexpr void Philox4x32Lanes(std::array<std::array<u32, Lanes>, 4>& counter, std::array<u32, 2> key) {
+        constexpr u32 Multiplier0 = 0xD2511F53u, Multiplier1 = 0xCD9E8D57u;
+        constexpr u32 Weyl0 = 0x9E3779B9u, Weyl1 = 0xBB67AE85u;
+
+        for (usize round = 0; round < 10; ++round) {
+            for (usize l = 0; l < Lanes; ++l) {
+                u64 product0 = static_cast<u64>(Multiplier0) * counter[0][l];
+                u64 product1 = static_cast<u64>(Multiplier1) * counter[2][l];
+                u32 word1 = counter[1][l], word3 = counter[3][l];
+
+                counter[0][l] = static_cast<u32>(product1 >> 32) ^ word1 ^ key[0];
+                counter[1][l] = static_cast<u32>(product1);
+                counter[2][l] = static_cast<u32>(product0 >> 32) ^ word3 ^ key[1];
+                counter[3][l] = static_cast<u32>(product0);
+            }
+
+            key[0] += Weyl0;
+            key[1] += Weyl1;
+        }
+    }
+
+    // A keyed bijection of a 128 bit counter: any block of the stream can be computed without computing the ones before it.
+    constexpr std::array<u32, 4> Philox4x32(std::array<u32, 4> counter, std::array<u32, 2> key) {
+        std::array<std::array<u32, 1>, 4> lanes = {{ {counter[0]}, {counter[1]}, {counter[2]}, {counter[3]} }};
+        Philox4x32Lanes(lanes, key);
+        return { lanes[0][0], lanes[1][0], lanes[2][0], lanes[3][0] };
+    }
+
+    // Counter based generator: (seed, stream) select an independent sequence, so every thread/block/vertex can have its own
+    // one and the output only depends on how the work is split, never on which thread did it or in which order.
+    // Also provides its own bounded and real distributions because the std ones differ between standard libraries.
+    struct CounterRandom final {
+        using result_type = u64;
+
+        constexpr explicit CounterRandom(u64 seed, u64 stream = 0)
+            : seed(seed), stream(stream), position(), buffer(), available() {}
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<u64>::max(); }
+
+        constexpr result_type operator()() {
+            if(this->available == 0) {
+                std::array<u32, 4> block = Philox4x32(
+                    { static_cast<u32>(this->position), static_cast<u32>(this->position >> 32), static_cast<u32>(this->stream), static_cast<u32>(this->stream >> 32) },
+                    { static_cast<u32>(this->seed), static_cast<u32>(this->seed >> 32) }
+                );
+
+                ++this->position;
+                this->buffer[0] = (static_cast<u64>(block[1]) << 32) | block[0];
+                this->buffer[1] = (static_cast<u64>(block[3]) << 32) | block[2];
+                this->available = 2;
+            }
+
+            return this->buffer[--this->available];
+        }
+
+        // Uniform in [0, 1)
+        constexpr f64 NextUnit() {
+            return static_cast<f64>((*this)() >> 11) * 0x1.0p-53;
+        }
+
+        // Uniform in [0, bound), unbiased
+        constexpr u64 NextBelow(u64 bound) {
+            u64 threshold = (0 - bound) % bound;
+
+            u64 value;
+            do {
+                value = (*this)();
+            } while(value < threshold);
+
+            return value % bound;
+        }
+
+    private:
+        u64 seed, stream, position;
+        std::array<u64, 2> buffer;
+        u8 available;
+    };
+} // namespace gpx
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef _GRAPHEXIA_SYMMETRICEIGEN__HPP_
+#define _GRAPHEXIA_SYMMETRICEIGEN__HPP_
+
+#include <Graphexia/Core.hpp>
+
+#include <vector>
+
+namespace gpx {
+    // Eigenvalues and eigenvectors of a small dense symmetric matrix (row major, size x size) by cyclic Jacobi rotations.
+    // Eigenvalues are in decreasing order and the eigenvectors are the columns of 'vectors'. O(size^3) per sweep, meant for the
+    // projected problems of the layouts (a Lanczos basis, Pivot MDS) and not for anything the size of a graph.
+    void SymmetricEigen(std::vector<f64> matrix, usize size, std::vector<f64>& values, std::vector<f64>& vectors);
+} // namespace gpx
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef _GRAPHEXIA_VERTEXATTRIBUTES__HPP_
+#define _GRAPHEXIA_VERTEXATTRIBUTES__HPP_
+
+#include <Graphexia/Core.hpp>
+
+#include <span>
+#include <string_view>
+
+namespace gpx {
+    // Per vertex data that lives outside the Graph (e.g. GraphView positions and labels) and can be written along it.
+    // All of them are optional, an empty span means there is nothing to write.
+    struct VertexAttributes {
+        // (x, y) per vertex
+        std::span<const f32> positions;
+        std::span<const std::string_view> labels;
+        // 0xRRGGBBAA per vertex
+        std::span<const u32> colors;
+
+        bool HasPositions(usize vertices) const { return vertices != 0 && this->positions.size() == 2 * vertices; }
+        bool HasLabels(usize vertices) const { return vertices != 0 && this->labels.size() == vertices; }
+        bool HasColors(usize vertices) const { return vertices != 0 && this->colors.size() == vertices; }
+    };
+
+    // Same for edges, indexed by edge id
+    struct EdgeAttributes {
+        // 0xRRGGBBAA per edge
+        std::span<const u32> colors;
+
+        bool HasColors(usize edges) const { return edges != 0 && this->colors.size() == edges; }
+    };
+} // namespace gpx
+
+#endif
@@ -0,0 +1,200 @@
+#include <Graphexia/Algo/Betweenness.hpp>
+#include <Graphexia/GraphCSR.hpp>
+#include <Graphexia/Parallel.hpp>
+#include <Graphexia/Random.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace gpx {
+    static constexpr usize NoDistance = std::numeric_limits<usize>::max();
+
+    struct BrandesWorkspace {
+        std::vector<usize> distances;
+        std::vector<f64> paths;
+        std::vector<f64> dependencies;
+        // BFS queue, read backwards it is also the stack of vertices by non-increasing distance
+        std::vector<usize> order;
+
+        std::vector<f64> vertexAccumulator;
+        std::vector<f64> edgeAccumulator;
+    };
+
+    static void AccumulateSource(const GraphCSR& csr, usize source, BrandesWorkspace& workspace) {
+        std::vector<usize>& distances = workspace.distances;
+        std::vector<f64>& paths = workspace.paths;
+        std::vector<f64>& dependencies = workspace.dependencies;
+        std::vector<usize>& order = workspace.order;
+
+        order.clear();
+        order.push_back(source);
+        distances[source] = 0;
+        paths[source] = 1;
+
+        for (usize i = 0; i < order.size(); ++i) {
+            usize v = order[i];
+            usize nextDistance = distances[v] + 1;
+
+            for (const usize w : csr.Adjacent(v)) {
+                if(distances[w] == NoDistance) {
+                    distances[w] = nextDistance;
+                    order.push_back(w);
+                }
+
+                // Parallel edges are different shortest paths
+                if(distances[w] == nextDistance) {
+                    paths[w] += paths[v];
+                }
+            }
+        }
+
+        // Successors are the adjacent vertices one level deeper, no predecessor lists needed
+        for (usize i = order.size(); i > 0; --i) {
+            usize v = order[i - 1];
+            usize nextDistance = distances[v] + 1;
+
+            std::span<const usize> adjacent = csr.Adjacent(v);
+            std::span<const usize> adjacentEdges = csr.AdjacentEdges(v);
+
+            f64 dependency = 0;
+            for (usize j = 0; j < adjacent.size(); ++j) {
+                usize w = adjacent[j];
+
+                if(distances[w] != nextDistance) {
+                    continue;
+                }
+
+                f64 contribution = (paths[v] / paths[w]) * (1. + dependencies[w]);
+                workspace.edgeAccumulator[adjacentEdges[j]] += contribution;
+                dependency += contribution;
+            }
+
+            dependencies[v] = dependency;
+            if(v != source) {
+                workspace.vertexAccumulator[v] += dependency;
+            }
+        }
+
+        // Only reset what this source touched
+        for (const usize v : order) {
+            distances[v] = NoDistance;
+            paths[v] = 0;
+            dependencies[v] = 0;
+        }
+    }
+
+    BetweennessResult Betweenness(const Graph& graph, const BetweennessOptions& options) {
+        usize verticesCount = graph.Vertices();
+        usize edgesCount = graph.Edges().size();
+
+        if(verticesCount == 0) {
+            return BetweennessResult{{}, std::vector<f64>(edgesCount), 0, 0};
+        }
+
+        GraphCSR csr = CreateCSR(graph, CSRDirection::Outgoing);
+
+        std::vector<usize> sources(verticesCount);
+        std::iota(sources.begin(), sources.end(), 0);
+
+        bool sampled = options.samples > 0 && options.samples < verticesCount;
+        if(sampled) { // Partial Fisher-Yates, the first 'samples' sources are an uniform sample without replacement
+            CounterRandom generator(options.seed);
+
+            for (usize i = 0; i < options.samples; ++i) {
+                std::swap(sources[i], sources[i + generator.NextBelow(verticesCount - i)]);
+            }
+
+            sources.resize(options.samples);
+        }
+
+        usize threads = std::min(ResolveThreads(options.threads), sources.size());
+        std::vector<BrandesWorkspace> workspaces(threads);
+        std::atomic<usize> nextSource = 0;
+
+        // Sources are handed out dynamically, BFS trees can have wildly different sizes
+        ParallelFor(0, threads, threads, [&](usize begin, usize end, usize) {
+            for (usize t = begin; t < end; ++t) {
+                BrandesWorkspace& workspace = workspaces[t];
+                workspace.distances.assign(verticesCount, NoDistance);
+                workspace.paths.assign(verticesCount, 0);
+                workspace.dependencies.assign(verticesCount, 0);
+                workspace.order.reserve(verticesCount);
+                workspace.vertexAccumulator.assign(verticesCount, 0);
+                workspace.edgeAccumulator.assign(edgesCount, 0);
+
+                usize i;
+                while((i = nextSource.fetch_add(1, std::memory_order_relaxed)) < sources.size()) {
+                    AccumulateSource(csr, sources[i], workspace);
+                }
+            }
+        }, 1);
+
+        f64 vertexScale = sampled ? static_cast<f64>(verticesCount) / sources.size() : 1.;
+        f64 edgeScale = vertexScale;
+
+        if(!graph.IsDirected()) { // Every pair was counted from both ends
+            vertexScale /= 2;
+            edgeScale /= 2;
+        }
+
+        if(options.normalized) {
+            f64 n = static_cast<f64>(verticesCount);
+            f64 pairs = graph.IsDirected() ? 1. : 2.;
+
+            vertexScale *= verticesCount > 2 ? pairs / ((n - 1) * (n - 2)) : 0.;
+            edgeScale *= verticesCount > 1 ? pairs / (n * (n - 1)) : 0.;
+        }
+
+        BetweennessResult result{
+            std::vector<f64>(verticesCount),
+            std::vector<f64>(edgesCount),
+            sources.size(),
+            0
+        };
+
+        ParallelFor(0, verticesCount, threads, [&](usize begin, usize end, usize) {
+            for (usize v = begin; v < end; ++v) {
+                f64 sum = 0;
+
+                for (const BrandesWorkspace& workspace : workspaces) {
+                    sum += workspace.vertexAccumulator[v];
+                }
+
+                result.vertices[v] = sum * vertexScale;
+            }
+        });
+
+        ParallelFor(0, edgesCount, threads, [&](usize begin, usize end, usize) {
+            for (usize e = begin; e < end; ++e) {
+                f64 sum = 0;
+
+                for (const BrandesWorkspace& workspace : workspaces) {
+                    sum += workspace.edgeAccumulator[e];
+                }
+
+                result.edges[e] = sum * edgeScale;
+            }
+        });
+
+        if(sampled) {
+            // Hoeffding + union bound over every vertex: every per source dependency lies in [0, n - 2]
+            f64 n = static_cast<f64>(verticesCount);
+            result.errorBound = (n / (n - 1)) * std::sqrt(std::log(2. * n / options.failureProbability) / (2. * sources.size()));
+        }
+
+        return result;
+    }
+
+    usize BetweennessSamplesFor(usize vertices, f64 epsilon, f64 failureProbability) {
+        if(vertices == 0 || epsilon <= 0) {
+            return vertices;
+        }
+
+        f64 samples = std::ceil(std::log(2. * vertices / failureProbability) / (2. * epsilon * epsilon));
+        return std::min(static_cast<usize>(samples), vertices);
+    }
+} // namespace gpx
@@ -0,0 +1,255 @@
+#include <Graphexia/Algo/Centrality.hpp>
+#include <Graphexia/GraphCSR.hpp>
+#include <Graphexia/Parallel.hpp>
+#include <Graphexia/SpMV.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace gpx {
+    // Per chunk reductions, padded to avoid false sharing between threads
+    struct alignas(64) ChunkReduction {
+        f64 difference;
+        f64 value;
+    };
+
+    struct CentralityContext {
+        GraphCSR incoming;
+        std::vector<usize> outDegrees;
+        std::vector<usize> bounds;
+    };
+
+    static CentralityContext CreateCentralityContext(const Graph& graph, usize threads) {
+        GraphCSR incoming = CreateCSR(graph, CSRDirection::Incoming);
+        std::vector<usize> outDegrees(graph.Vertices());
+
+        if(graph.IsDirected()) {
+            for (const Edge& edge : graph.Edges()) {
+                ++outDegrees[edge.fromId];
+            }
+        } else {
+            for (usize i = 0; i < graph.Vertices(); ++i) {
+                outDegrees[i] = incoming.Degree(i);
+            }
+        }
+
+        std::vector<usize> bounds = BalancedBounds(incoming, ResolveThreads(threads));
+        return CentralityContext{
+            std::move(incoming),
+            std::move(outDegrees),
+            std::move(bounds)
+        };
+    }
+
+    template<typename T>
+    static std::vector<f64> ToScores(const std::vector<T>& values) {
+        return std::vector<f64>(values.begin(), values.end());
+    }
+
+    template<typename T>
+    static CentralityResult PageRankImpl(const Graph& graph, f64 damping, const CentralityOptions& options) {
+        usize verticesCount = graph.Vertices();
+        CentralityContext context = CreateCentralityContext(graph, options.threads);
+
+        std::vector<T> inverseDegrees(verticesCount);
+        for (usize i = 0; i < verticesCount; ++i) {
+            inverseDegrees[i] = context.outDegrees[i] ? T(1) / context.outDegrees[i] : T(0);
+        }
+
+        const f64 initial = 1. / verticesCount;
+        std::vector<T> ranks(verticesCount, static_cast<T>(initial));
+        std::vector<T> nextRanks(verticesCount);
+        std::vector<T> contributions(verticesCount);
+
+        f64 danglingRank = 0;
+        for (usize i = 0; i < verticesCount; ++i) {
+            contributions[i] = ranks[i] * inverseDegrees[i];
+            danglingRank += context.outDegrees[i] ? 0. : initial;
+        }
+
+        std::vector<ChunkReduction> reductions(context.bounds.size() - 1);
+        usize iteration = 0;
+        bool converged = false;
+
+        while(iteration < options.maxIterations && !converged) {
+            ++iteration;
+
+            // Dangling vertices spread their rank uniformly
+            const T base = static_cast<T>((1. - damping) / verticesCount + damping * danglingRank / verticesCount);
+            const T factor = static_cast<T>(damping);
+
+            std::fill(reductions.begin(), reductions.end(), ChunkReduction{});
+            PullSpMV(context.incoming, contributions.data(), context.bounds, [&](usize v, T sum, usize chunk) {
+                T rank = base + factor * sum;
+
+                nextRanks[v] = rank;
+                reductions[chunk].difference += std::abs(static_cast<f64>(rank - ranks[v]));
+                reductions[chunk].value += inverseDegrees[v] == T(0) ? static_cast<f64>(rank) : 0.;
+            });
+
+            // Contributions can only be computed once every rank of this iteration is known
+            ParallelForChunks(context.bounds, [&](usize begin, usize end, usize) {
+                for (usize v = begin; v < end; ++v) {
+                    contributions[v] = nextRanks[v] * inverseDegrees[v];
+                }
+            });
+
+            f64 difference = 0;
+            danglingRank = 0;
+            for (const ChunkReduction& reduction : reductions) {
+                difference += reduction.difference;
+                danglingRank += reduction.value;
+            }
+
+            ranks.swap(nextRanks);
+            converged = difference < verticesCount * options.tolerance;
+        }
+
+        return CentralityResult{ToScores(ranks), iteration, converged};
+    }
+
+    // Power iteration over (A + I), the shift keeps the iteration from oscillating on bipartite graphs without changing the eigenvectors
+    template<typename T>
+    static CentralityResult EigenvectorImpl(const Graph& graph, const CentralityOptions& options) {
+        usize verticesCount = graph.Vertices();
+        CentralityContext context = CreateCentralityContext(graph, options.threads);
+
+        std::vector<T> scores(verticesCount, static_cast<T>(1. / verticesCount));
+        std::vector<T> nextScores(verticesCount);
+
+        std::vector<ChunkReduction> reductions(context.bounds.size() - 1);
+        usize iteration = 0;
+        bool converged = false;
+
+        while(iteration < options.maxIterations && !converged) {
+            ++iteration;
+
+            std::fill(reductions.begin(), reductions.end(), ChunkReduction{});
+            PullSpMV(context.incoming, scores.data(), context.bounds, [&](usize v, T sum, usize chunk) {
+                T score = scores[v] + sum;
+
+                nextScores[v] = score;
+                reductions[chunk].value += static_cast<f64>(score) * score;
+            });
+
+            f64 squaredNorm = 0;
+            for (const ChunkReduction& reduction : reductions) {
+                squaredNorm += reduction.value;
+            }
+
+            if(squaredNorm == 0) { // No edges at all, every vertex is equally (un)important
+                break;
+            }
+
+            const T inverseNorm = static_cast<T>(1. / std::sqrt(squaredNorm));
+            std::fill(reductions.begin(), reductions.end(), ChunkReduction{});
+            ParallelForChunks(context.bounds, [&](usize begin, usize end, usize chunk) {
+                for (usize v = begin; v < end; ++v) {
+                    T score = nextScores[v] * inverseNorm;
+
+                    reductions[chunk].difference += std::abs(static_cast<f64>(score - scores[v]));
+                    nextScores[v] = score;
+                }
+            });
+
+            f64 difference = 0;
+            for (const ChunkReduction& reduction : reductions) {
+                difference += reduction.difference;
+            }
+
+            scores.swap(nextScores);
+            converged = difference < verticesCount * options.tolerance;
+        }
+
+        return CentralityResult{ToScores(scores), iteration, converged};
+    }
+
+    template<typename T>
+    static CentralityResult KatzImpl(const Graph& graph, f64 alpha, f64 beta, const CentralityOptions& options) {
+        usize verticesCount = graph.Vertices();
+        CentralityContext context = CreateCentralityContext(graph, options.threads);
+
+        std::vector<T> scores(verticesCount);
+        std::vector<T> nextScores(verticesCount);
+
+        const T tAlpha = static_cast<T>(alpha);
+        const T tBeta = static_cast<T>(beta);
+
+        std::vector<ChunkReduction> reductions(context.bounds.size() - 1);
+        usize iteration = 0;
+        bool converged = false;
+
+        while(iteration < options.maxIterations && !converged) {
+            ++iteration;
+
+            std::fill(reductions.begin(), reductions.end(), ChunkReduction{});
+            PullSpMV(context.incoming, scores.data(), context.bounds, [&](usize v, T sum, usize chunk) {
+                T score = tAlpha * sum + tBeta;
+
+                nextScores[v] = score;
+                reductions[chunk].difference += std::abs(static_cast<f64>(score - scores[v]));
+                reductions[chunk].value += static_cast<f64>(score) * score;
+            });
+
+            f64 difference = 0;
+            for (const ChunkReduction& reduction : reductions) {
+                difference += reduction.difference;
+            }
+
+            scores.swap(nextScores);
+            converged = difference < verticesCount * options.tolerance;
+        }
+
+        f64 squaredNorm = 0;
+        for (const ChunkReduction& reduction : reductions) {
+            squaredNorm += reduction.value;
+        }
+
+        std::vector<f64> result = ToScores(scores);
+        if(squaredNorm > 0) {
+            const f64 inverseNorm = 1. / std::sqrt(squaredNorm);
+
+            for (f64& score : result) {
+                score *= inverseNorm;
+            }
+        }
+
+        return CentralityResult{std::move(result), iteration, converged};
+    }
+
+    CentralityResult PageRank(const Graph& graph, f64 damping, const CentralityOptions& options) {
+        if(!graph.Vertices()) {
+            return CentralityResult{{}, 0, true};
+        }
+
+        return options.singlePrecision ? PageRankImpl<f32>(graph, damping, options) : PageRankImpl<f64>(graph, damping, options);
+    }
+
+    CentralityResult EigenvectorCentrality(const Graph& graph, const CentralityOptions& options) {
+        if(!graph.Vertices()) {
+            return CentralityResult{{}, 0, true};
+        }
+
+        return options.singlePrecision ? EigenvectorImpl<f32>(graph, options) : EigenvectorImpl<f64>(graph, options);
+    }
+
+    CentralityResult KatzCentrality(const Graph& graph, f64 alpha, f64 beta, const CentralityOptions& options) {
+        if(!graph.Vertices()) {
+            return CentralityResult{{}, 0, true};
+        }
+
+        return options.singlePrecision ? KatzImpl<f32>(graph, alpha, beta, options) : KatzImpl<f64>(graph, alpha, beta, options);
+    }
+
+    f64 KatzAlphaFor(const Graph& graph, f64 fraction) {
+        std::vector<usize> degrees(graph.Vertices());
+        for (const Edge& edge : graph.Edges()) {
+            ++degrees[edge.fromId];
+            ++degrees[edge.toId];
+        }
+
+        usize maxDegree = degrees.empty() ? 0 : *std::max_element(degrees.begin(), degrees.end());
+        return fraction / std::max<usize>(maxDegree, 1);
+    }
+} // namespace gpx
@@ -0,0 +1,342 @@
+#include <Graphexia/Algo/Coloring.hpp>
+#include <Graphexia/GraphCSR.hpp>
+#include <Graphexia/Parallel.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace gpx {
+    static constexpr usize NoColor = std::numeric_limits<usize>::max();
+    static constexpr usize NoVertex = std::numeric_limits<usize>::max();
+
+    // Doubly linked lists of vertices indexed by an integer key, O(1) insertion, removal and key change
+    struct BucketQueue {
+        std::vector<usize> heads;
+        std::vector<usize> next;
+        std::vector<usize> previous;
+        std::vector<usize> keys;
+
+        BucketQueue(usize vertices, usize maximumKey)
+            : heads(maximumKey + 1, NoVertex), next(vertices, NoVertex), previous(vertices, NoVertex), keys(vertices) {}
+
+        void Insert(usize v, usize key) {
+            this->keys[v] = key;
+            this->previous[v] = NoVertex;
+            this->next[v] = this->heads[key];
+
+            if(this->heads[key] != NoVertex) {
+                this->previous[this->heads[key]] = v;
+            }
+
+            this->heads[key] = v;
+        }
+
+        void Remove(usize v) {
+            if(this->previous[v] != NoVertex) {
+                this->next[this->previous[v]] = this->next[v];
+            } else {
+                this->heads[this->keys[v]] = this->next[v];
+            }
+
+            if(this->next[v] != NoVertex) {
+                this->previous[this->next[v]] = this->previous[v];
+            }
+        }
+
+        void Move(usize v, usize key) {
+            this->Remove(v);
+            this->Insert(v, key);
+        }
+    };
+
+    static usize MaximumDegree(const GraphCSR& csr) {
+        usize maximum = 0;
+
+        for (usize i = 0; i < csr.Vertices(); ++i) {
+            maximum = std::max(maximum, csr.Degree(i));
+        }
+
+        return maximum;
+    }
+
+    // Smallest color not used by any colored neighbour. forbidden must hold at least (degree + 1) entries,
+    // entries equal to (v + 1) are the colors forbidden for v so it never needs to be cleared.
+    static usize SmallestAvailableColor(const GraphCSR& csr, const std::vector<usize>& colors, usize v, std::vector<usize>& forbidden) {
+        for (const usize w : csr.Adjacent(v)) {
+            usize color = colors[w];
+
+            if(w != v && color < forbidden.size()) {
+                forbidden[color] = v + 1;
+            }
+        }
+
+        usize color = 0;
+        while(forbidden[color] == v + 1) {
+            ++color;
+        }
+
+        return color;
+    }
+
+    static std::vector<usize> LargestFirstOrder(const GraphCSR& csr) {
+        usize verticesCount = csr.Vertices();
+        usize maximumDegree = MaximumDegree(csr);
+
+        // Counting sort by decreasing degree
+        std::vector<usize> starts(maximumDegree + 2);
+        for (usize i = 0; i < verticesCount; ++i) {
+            ++starts[maximumDegree - csr.Degree(i) + 1];
+        }
+
+        for (usize i = 0; i <= maximumDegree; ++i) {
+            starts[i + 1] += starts[i];
+        }
+
+        std::vector<usize> order(verticesCount);
+        for (usize i = 0; i < verticesCount; ++i) {
+            order[starts[maximumDegree - csr.Degree(i)]++] = i;
+        }
+
+        return order;
+    }
+
+    // Matula & Beck: repeatedly remove a vertex of minimum degree, color them in reverse removal order
+    static std::vector<usize> SmallestLastOrder(const GraphCSR& csr) {
+        usize verticesCount = csr.Vertices();
+        BucketQueue queue(verticesCount, MaximumDegree(csr));
+        std::vector<bool> removed(verticesCount);
+
+        for (usize i = 0; i < verticesCount; ++i) {
+            queue.Insert(i, csr.Degree(i));
+        }
+
+        std::vector<usize> order(verticesCount);
+        usize minimum = 0;
+
+        for (usize i = verticesCount; i > 0; --i) {
+            while(queue.heads[minimum] == NoVertex) {
+                ++minimum;
+            }
+
+            usize v = queue.heads[minimum];
+            queue.Remove(v);
+            removed[v] = true;
+            order[i - 1] = v;
+
+            for (const usize w : csr.Adjacent(v)) {
+                if(removed[w]) {
+                    continue;
+                }
+
+                usize degree = queue.keys[w] - 1;
+                queue.Move(w, degree);
+                minimum = std::min(minimum, degree);
+            }
+        }
+
+        return order;
+    }
+
+    ColoringResult GreedyColoring(const Graph& graph, ColoringOrder order) {
+        usize verticesCount = graph.Vertices();
+        GraphCSR csr = CreateCSR(graph, CSRDirection::Both);
+
+        std::vector<usize> vertexOrder;
+        switch (order) {
+            case ColoringOrder::LargestFirst: vertexOrder = LargestFirstOrder(csr); break;
+            case ColoringOrder::SmallestLast: vertexOrder = SmallestLastOrder(csr); break;
+            default: {
+                vertexOrder.resize(verticesCount);
+                std::iota(vertexOrder.begin(), vertexOrder.end(), 0);
+                break;
+            }
+        }
+
+        std::vector<usize> colors(verticesCount, NoColor);
+        std::vector<usize> forbidden(MaximumDegree(csr) + 1);
+        usize colorCount = 0;
+
+        for (const usize v : vertexOrder) {
+            usize color = SmallestAvailableColor(csr, colors, v, forbidden);
+
+            colors[v] = color;
+            colorCount = std::max(colorCount, color + 1);
+        }
+
+        return ColoringResult{std::move(colors), colorCount};
+    }
+
+    ColoringResult DSaturColoring(const Graph& graph) {
+        usize verticesCount = graph.Vertices();
+        GraphCSR csr = CreateCSR(graph, CSRDirection::Both);
+        usize maximumDegree = MaximumDegree(csr);
+
+        BucketQueue queue(verticesCount, maximumDegree);
+
+        // Inserting by increasing degree leaves the highest degree vertices at the head of each bucket
+        std::vector<usize> byDegree = LargestFirstOrder(csr);
+        for (usize i = verticesCount; i > 0; --i) {
+            queue.Insert(byDegree[i - 1], 0);
+        }
+
+        // Distinct neighbour colors of every vertex. A vertex of degree d has at most d of them, colors <= d are stored in a bitmap
+        // slice of (d + 1) entries at offsets[v] + v, the rare bigger ones spill into a hash set.
+        std::vector<bool> seenColors(csr.Entries() + verticesCount);
+        std::unordered_map<usize, std::unordered_set<usize>> spilledColors;
+
+        std::vector<usize> colors(verticesCount, NoColor);
+        std::vector<usize> forbidden(maximumDegree + 1);
+        usize colorCount = 0;
+        usize maximumSaturation = 0;
+
+        for (usize i = 0; i < verticesCount; ++i) {
+            while(queue.heads[maximumSaturation] == NoVertex) {
+                --maximumSaturation;
+            }
+
+            usize v = queue.heads[maximumSaturation];
+            queue.Remove(v);
+
+            usize color = SmallestAvailableColor(csr, colors, v, forbidden);
+            colors[v] = color;
+            colorCount = std::max(colorCount, color + 1);
+
+            for (const usize w : csr.Adjacent(v)) {
+                if(colors[w] != NoColor) {
+                    continue;
+                }
+
+                bool newColor;
+                if(color <= csr.Degree(w)) {
+                    std::vector<bool>::reference seen = seenColors[csr.offsets[w] + w + color];
+
+                    newColor = !seen;
+                    seen = true;
+                } else {
+                    newColor = spilledColors[w].insert(color).second;
+                }
+
+                if(newColor) {
+                    usize saturation = queue.keys[w] + 1;
+
+                    queue.Move(w, saturation);
+                    maximumSaturation = std::max(maximumSaturation, saturation);
+                }
+            }
+        }
+
+        return ColoringResult{std::move(colors), colorCount};
+    }
+
+    static u64 VertexPriority(u64 seed, usize v) {
+        // splitmix64 finalizer
+        u64 z = seed + (static_cast<u64>(v) + 1) * 0x9E3779B97F4A7C15ull;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    ColoringResult JonesPlassmannColoring(const Graph& graph, u64 seed, usize threads) {
+        usize verticesCount = graph.Vertices();
+        GraphCSR csr = CreateCSR(graph, CSRDirection::Both);
+        threads = ResolveThreads(threads);
+
+        std::vector<u64> priorities(verticesCount);
+        ParallelFor(0, verticesCount, threads, [&](usize begin, usize end, usize) {
+            for (usize v = begin; v < end; ++v) {
+                priorities[v] = VertexPriority(seed, v);
+            }
+        });
+
+        // Total order on (priority, id) so equal priorities can't deadlock
+        auto higher = [&priorities](usize a, usize b) {
+            return priorities[a] > priorities[b] || (priorities[a] == priorities[b] && a > b);
+        };
+
+        // Amount of higher priority neighbours that are still uncolored
+        std::vector<usize> waiting(verticesCount);
+        std::vector<std::vector<usize>> threadFrontiers(threads);
+        ParallelFor(0, verticesCount, threads, [&](usize begin, usize end, usize thread) {
+            for (usize v = begin; v < end; ++v) {
+                usize count = 0;
+
+                for (const usize w : csr.Adjacent(v)) {
+                    count += w != v && higher(w, v);
+                }
+
+                waiting[v] = count;
+                if(count == 0) {
+                    threadFrontiers[thread].push_back(v);
+                }
+            }
+        });
+
+        std::vector<usize> frontier;
+        for (std::vector<usize>& threadFrontier : threadFrontiers) {
+            frontier.insert(frontier.end(), threadFrontier.begin(), threadFrontier.end());
+            threadFrontier.clear();
+        }
+
+        usize maximumDegree = MaximumDegree(csr);
+        std::vector<usize> colors(verticesCount, NoColor);
+        std::vector<std::vector<usize>> forbidden(threads, std::vector<usize>(maximumDegree + 1));
+        std::vector<usize> threadColorCounts(threads);
+
+        while(!frontier.empty()) {
+            // The frontier is an independent set whose higher priority neighbours are all colored, so coloring it concurrently is race free
+            ParallelFor(0, frontier.size(), threads, [&](usize begin, usize end, usize thread) {
+                for (usize i = begin; i < end; ++i) {
+                    usize v = frontier[i];
+                    usize color = SmallestAvailableColor(csr, colors, v, forbidden[thread]);
+
+                    colors[v] = color;
+                    threadColorCounts[thread] = std::max(threadColorCounts[thread], color + 1);
+                }
+            }, 256);
+
+            ParallelFor(0, frontier.size(), threads, [&](usize begin, usize end, usize thread) {
+                for (usize i = begin; i < end; ++i) {
+                    usize v = frontier[i];
+
+                    for (const usize w : csr.Adjacent(v)) {
+                        if(w == v || !higher(v, w)) {
+                            continue;
+                        }
+
+                        if(std::atomic_ref<usize>(waiting[w]).fetch_sub(1, std::memory_order_relaxed) == 1) {
+                            threadFrontiers[thread].push_back(w);
+                        }
+                    }
+                }
+            }, 256);
+
+            frontier.clear();
+            for (std::vector<usize>& threadFrontier : threadFrontiers) {
+                frontier.insert(frontier.end(), threadFrontier.begin(), threadFrontier.end());
+                threadFrontier.clear();
+            }
+        }
+
+        usize colorCount = *std::max_element(threadColorCounts.begin(), threadColorCounts.end());
+        return ColoringResult{std::move(colors), colorCount};
+    }
+
+    bool IsProperColoring(const Graph& graph, const std::vector<usize>& colors) {
+        if(colors.size() != graph.Vertices()) {
+            return false;
+        }
+
+        for (const Edge& edge : graph.Edges()) {
+            if(edge.fromId != edge.toId && colors[edge.fromId] == colors[edge.toId]) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+} // namespace gpx
@@ -0,0 +1,148 @@
+#include <Graphexia/Algo/ConfigurationModel.hpp>
+#include <Graphexia/Algo/Hakimi.hpp>
+#include <Graphexia/Random.hpp>
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace gpx {
+    // Multiplicity of every undirected edge, keyed by (min * n + max)
+    struct EdgeCounts {
+        std::unordered_map<u64, u32> counts;
+        u64 vertices;
+
+        u64 Key(usize a, usize b) const { return std::min(a, b) * this->vertices + std::max(a, b); }
+        u32& Count(usize a, usize b) { return this->counts[this->Key(a, b)]; }
+
+        void Remove(usize a, usize b) {
+            auto it = this->counts.find(this->Key(a, b));
+
+            if(--it->second == 0) {
+                this->counts.erase(it);
+            }
+        }
+
+        bool Contains(usize a, usize b) const { return this->counts.contains(this->Key(a, b)); }
+    };
+
+    // Replaces edges i (a-b) and j (c-d) with a-d, c-b (or a-c, b-d) when that doesn't create a loop or a parallel edge
+    static bool TrySwap(std::vector<Edge>& edges, EdgeCounts& counts, usize i, usize j, bool crossed) {
+        usize a = edges[i].fromId, b = edges[i].toId;
+        usize c = edges[j].fromId, d = edges[j].toId;
+
+        if(crossed) {
+            std::swap(c, d);
+        }
+
+        // New edges: a-d and c-b
+        if(a == d || c == b || counts.Key(a, d) == counts.Key(c, b)) {
+            return false;
+        }
+
+        counts.Remove(a, b);
+        counts.Remove(edges[j].fromId, edges[j].toId);
+
+        if(counts.Contains(a, d) || counts.Contains(c, b)) {
+            ++counts.Count(a, b);
+            ++counts.Count(edges[j].fromId, edges[j].toId);
+            return false;
+        }
+
+        ++counts.Count(a, d);
+        ++counts.Count(c, b);
+        edges[i] = Edge{a, d, 0};
+        edges[j] = Edge{c, b, 0};
+        return true;
+    }
+
+    std::optional<Graph> CreateConfigurationModel(std::span<usize> sequence, u64 seed) {
+        usize verticesCount = sequence.size();
+
+        u64 degreesSum = 0;
+        for (const usize degree : sequence) {
+            degreesSum += degree;
+        }
+
+        if(degreesSum & 1) {
+            return std::nullopt;
+        }
+
+        std::vector<usize> stubs;
+        stubs.reserve(degreesSum);
+        for (usize i = 0; i < verticesCount; ++i) {
+            stubs.insert(stubs.end(), sequence[i], i);
+        }
+
+        // Fisher-Yates by hand, std::shuffle gives different orders on different standard libraries
+        CounterRandom generator(seed);
+        for (usize i = stubs.size(); i > 1; --i) {
+            std::swap(stubs[i - 1], stubs[generator.NextBelow(i)]);
+        }
+
+        usize edgesCount = stubs.size() / 2;
+        std::vector<Edge> edges(edgesCount);
+        EdgeCounts counts{std::unordered_map<u64, u32>(), verticesCount};
+        counts.counts.reserve(edgesCount);
+
+        for (usize i = 0; i < edgesCount; ++i) {
+            edges[i] = Edge{stubs[2 * i], stubs[2 * i + 1], 0};
+            ++counts.Count(edges[i].fromId, edges[i].toId);
+        }
+
+        stubs = std::vector<usize>();
+
+        // Reject loops and parallel edges one by one, swapping them with a random edge until both are fine
+        usize budget = 64 * edgesCount + 1024;
+
+        for (usize i = 0; i < edgesCount; ++i) {
+            while(edges[i].fromId == edges[i].toId || counts.Count(edges[i].fromId, edges[i].toId) > 1) {
+                if(budget-- == 0) { // Dense sequences can get stuck, mixing a deterministic realization always works
+                    if(!IsGraphicSequence(sequence)) {
+                        return std::nullopt;
+                    }
+
+                    return DegreePreservingShuffle(CreateFromGraphicSequence(sequence), 10, seed);
+                }
+
+                usize j = generator.NextBelow(edgesCount);
+                if(j != i) {
+                    TrySwap(edges, counts, i, j, generator() & 1);
+                }
+            }
+        }
+
+        return Graph(verticesCount, std::move(edges));
+    }
+
+    Graph DegreePreservingShuffle(const Graph& graph, usize swapsPerEdge, u64 seed) {
+        std::vector<Edge> edges = graph.Edges();
+        usize edgesCount = edges.size();
+
+        EdgeCounts counts{std::unordered_map<u64, u32>(), graph.Vertices()};
+        counts.counts.reserve(edgesCount);
+
+        for (Edge& edge : edges) {
+            edge.weight = 0;
+            ++counts.Count(edge.fromId, edge.toId);
+        }
+
+        if(edgesCount >= 2) {
+            CounterRandom generator(seed);
+
+            for (usize attempt = 0; attempt < swapsPerEdge * edgesCount; ++attempt) {
+                usize i = generator.NextBelow(edgesCount);
+                usize j = generator.NextBelow(edgesCount);
+
+                // Swapping around an already invalid edge could make it worse, leave those alone
+                if(i == j || edges[i].fromId == edges[i].toId || edges[j].fromId == edges[j].toId) {
+                    continue;
+                }
+
+                TrySwap(edges, counts, i, j, generator() & 1);
+            }
+        }
+
+        return Graph(graph.Vertices(), std::move(edges));
+    }
+} // namespace gpx
@@ -0,0 +1,137 @@
+#include <Graphexia/Algo/Eulerian.hpp>
+#include <Graphexia/GraphCSR.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace gpx {
+    static constexpr usize None = std::numeric_limits<usize>::max();
+
+    // Vertex where the path has to start, or None if the degrees rule out any Eulerian path
+    static usize FindStart(const Graph& graph, const GraphCSR& csr) {
+        usize verticesCount = graph.Vertices();
+        usize start = None;
+
+        if(graph.IsDirected()) {
+            std::vector<usize> inDegrees(verticesCount);
+            for (const Edge& edge : graph.Edges()) {
+                ++inDegrees[edge.toId];
+            }
+
+            usize starts = 0, ends = 0;
+            for (usize v = 0; v < verticesCount; ++v) {
+                usize out = csr.Degree(v);
+
+                if(out == inDegrees[v] + 1) {
+                    ++starts;
+                    start = v;
+                } else if(inDegrees[v] == out + 1) {
+                    ++ends;
+                } else if(inDegrees[v] != out) {
+                    return None;
+                }
+            }
+
+            if(starts > 1 || ends > 1 || starts != ends) {
+                return None;
+            }
+        } else {
+            usize odd = 0;
+
+            for (usize v = 0; v < verticesCount; ++v) {
+                if(csr.Degree(v) & 1) {
+                    ++odd;
+
+                    if(start == None) {
+                        start = v;
+                    }
+                }
+            }
+
+            if(odd != 0 && odd != 2) {
+                return None;
+            }
+        }
+
+        if(start != None) {
+            return start;
+        }
+
+        // Balanced degrees, any vertex with edges works
+        for (usize v = 0; v < verticesCount; ++v) {
+            if(csr.Degree(v)) {
+                return v;
+            }
+        }
+
+        return None;
+    }
+
+    EulerianResult EulerianPath(const Graph& graph) {
+        const std::vector<Edge>& edges = graph.Edges();
+
+        // The empty path stays on a single vertex
+        if(edges.empty()) {
+            return EulerianResult{true, true, std::vector<usize>(), graph.Vertices() ? std::vector<usize>{0} : std::vector<usize>()};
+        }
+
+        GraphCSR csr = CreateCSR(graph, CSRDirection::Outgoing);
+        usize start = FindStart(graph, csr);
+
+        if(start == None) {
+            return EulerianResult{false, false, std::vector<usize>(), std::vector<usize>()};
+        }
+
+        // Undirected edges show up in the adjacency of both endpoints, so they must be flagged when used.
+        // Cursors only move forward, every adjacency entry is looked at once.
+        std::vector<bool> usedEdges(edges.size());
+        std::vector<usize> cursors(csr.offsets.begin(), csr.offsets.end() - 1);
+
+        // (Vertex, Edge used to reach it)
+        std::vector<std::pair<usize, usize>> stack{{start, None}};
+        std::vector<usize> pathEdges;
+        std::vector<usize> pathVertices;
+        pathEdges.reserve(edges.size());
+        pathVertices.reserve(edges.size() + 1);
+
+        while(!stack.empty()) {
+            usize v = stack.back().first;
+            usize& cursor = cursors[v];
+            usize end = csr.offsets[v + 1];
+
+            while(cursor < end && usedEdges[csr.edgeIds[cursor]]) {
+                ++cursor;
+            }
+
+            if(cursor == end) {
+                auto [vertex, edgeId] = stack.back();
+                stack.pop_back();
+
+                pathVertices.push_back(vertex);
+                if(edgeId != None) {
+                    pathEdges.push_back(edgeId);
+                }
+                continue;
+            }
+
+            usize edgeId = csr.edgeIds[cursor];
+            usize next = csr.adjacent[cursor++];
+
+            usedEdges[edgeId] = true;
+            stack.push_back(std::make_pair(next, edgeId));
+        }
+
+        // Edges in another connected component were never reached
+        if(pathEdges.size() != edges.size()) {
+            return EulerianResult{false, false, std::vector<usize>(), std::vector<usize>()};
+        }
+
+        std::reverse(pathEdges.begin(), pathEdges.end());
+        std::reverse(pathVertices.begin(), pathVertices.end());
+
+        bool circuit = pathVertices.front() == pathVertices.back();
+        return EulerianResult{true, circuit, std::move(pathEdges), std::move(pathVertices)};
+    }
+} // namespace gpx
@@ -1,7 +1,6 @@
 #include <Graphexia/Algo/Hakimi.hpp>
 #include <algorithm>
 #include <cmath>
-#include <numeric>
 
 namespace gpx {
     struct SequenceVertex {
@@ -9,69 +8,129 @@ namespace gpx {
         usize degree;
     };
 
+    // Erdős–Gallai in O(n): degrees are counting sorted (anything >= n can't be graphic anyway) and every
+    // sum_{i > k} min(d_i, k) is computed in O(1) from how many degrees are >= k and the suffix sums of the sorted degrees.
     bool IsGraphicSequence(std::span<usize> sequence) {
-        usize degreesSum = std::accumulate(sequence.begin(), sequence.end(), 0);
+        usize length = sequence.size();
+
+        // u64, the sum of a big sequence would overflow a 32 bit usize
+        u64 degreesSum = 0;
+        std::vector<usize> counts(length + 1);
+
+        for (const usize degree : sequence) {
+            if(degree >= length) {
+                return false;
+            }
+
+            ++counts[degree];
+            degreesSum += degree;
+        }
 
         // Invalid progression, the sum of all degrees is not even
         if(degreesSum == 0 || (degreesSum & 1)) {
             return false;
         }
 
-        std::vector<usize> degrees(sequence.begin(), sequence.end());
-
-        do {
-            std::sort(degrees.begin(), degrees.end());
+        // Non increasing order
+        std::vector<usize> degrees;
+        degrees.reserve(length);
+        for (usize degree = length; degree > 0; --degree) {
+            degrees.insert(degrees.end(), counts[degree - 1], degree - 1);
+        }
 
-            usize lastDegreeIndex = degrees.size() - 1;
-            usize highestDegree = degrees[lastDegreeIndex];
-            degrees.pop_back();
+        // atLeast[k] = amount of degrees >= k
+        std::vector<usize> atLeast(length + 1);
+        for (usize k = length; k > 0; --k) {
+            atLeast[k - 1] = atLeast[k] + counts[k - 1];
+        }
 
-            if(highestDegree == 0)
-                return true;
+        // suffixSums[i] = degrees[i] + ... + degrees[length - 1]
+        std::vector<u64> suffixSums(length + 1);
+        for (usize i = length; i > 0; --i) {
+            suffixSums[i - 1] = suffixSums[i] + degrees[i - 1];
+        }
 
-            if(lastDegreeIndex < highestDegree)
-                return false;
+        u64 prefixSum = 0;
+        for (usize k = 1; k <= length; ++k) {
+            prefixSum += degrees[k - 1];
 
-            usize firstDegreeAffected = lastDegreeIndex - highestDegree;
-            for(usize i = lastDegreeIndex; i > firstDegreeAffected; --i) {
-                usize index = i - 1;
-                
-                if(degrees[index] == 0)
-                    return false;
+            // Degrees after position k that are >= k contribute k, the rest contribute themselves
+            usize boundary = std::max(k, atLeast[k]);
+            u64 bound = static_cast<u64>(k) * (k - 1) + static_cast<u64>(boundary - k) * k + suffixSums[boundary];
 
-                --degrees[index];
+            if(prefixSum > bound) {
+                return false;
             }
-        } while(degrees.size() > 0);
+        }
 
         return true;
     }
 
+    // Havel-Hakimi with vertices bucketed by remaining degree. The pivot always has the highest degree d, so collecting the next d
+    // highest vertices only scans O(d) buckets and the whole realization is O(n + m).
     Graph CreateFromGraphicSequence(std::span<usize> sequence) {
-        Graph sequenceGraph(sequence.size());
+        u64 degreesSum = 0;
+        usize maximumDegree = 0;
 
-        std::vector<SequenceVertex> vertices(sequence.size());
+        for (const usize degree : sequence) {
+            degreesSum += degree;
+            maximumDegree = std::max(maximumDegree, degree);
+        }
 
+        std::vector<std::vector<usize>> buckets(maximumDegree + 1);
         for (usize i = 0; i < sequence.size(); ++i) {
-            vertices[i] = SequenceVertex{i, sequence[i]}; 
+            if(sequence[i] > 0) {
+                buckets[sequence[i]].push_back(i);
+            }
         }
 
-        do {
-            std::sort(vertices.begin(), vertices.end(), [](SequenceVertex l, SequenceVertex r) { return l.degree < r.degree; });
+        std::vector<Edge> edges;
+        edges.reserve(degreesSum / 2);
+
+        std::vector<SequenceVertex> chosen;
+        chosen.reserve(maximumDegree);
+
+        usize highest = maximumDegree;
+        while(true) {
+            while(highest > 0 && buckets[highest].empty()) {
+                --highest;
+            }
+
+            if(highest == 0) {
+                break;
+            }
+
+            usize pivot = buckets[highest].back();
+            buckets[highest].pop_back();
 
-            usize lastDegreeIndex = vertices.size() - 1;
-            SequenceVertex highestDegree = vertices[lastDegreeIndex];
-            vertices.pop_back();
+            // Take them out first so a decremented vertex can't be picked twice
+            usize bucket = highest;
+            chosen.clear();
+            while(chosen.size() < highest && bucket > 0) {
+                std::vector<usize>& current = buckets[bucket];
 
-            usize firstDegreeAffected = lastDegreeIndex - highestDegree.degree;
-            for(usize i = lastDegreeIndex; i > firstDegreeAffected; --i) {
-                usize index = i - 1;
-                SequenceVertex& seqVertex = vertices[index]; 
+                while(chosen.size() < highest && !current.empty()) {
+                    chosen.push_back(SequenceVertex{current.back(), bucket});
+                    current.pop_back();
+                }
 
-                sequenceGraph.AddEdge(highestDegree.id, seqVertex.id);
-                --seqVertex.degree;
-            } 
-        } while(vertices.size() > 0);
+                --bucket;
+            }
+
+            // Not a graphic sequence, realize as much as possible
+            if(chosen.size() < highest) {
+                break;
+            }
+
+            for (const SequenceVertex& vertex : chosen) {
+                edges.push_back(Edge{pivot, vertex.id, 0});
+
+                if(vertex.degree > 1) {
+                    buckets[vertex.degree - 1].push_back(vertex.id);
+                }
+            }
+        }
 
-        return sequenceGraph;
+        return Graph(sequence.size(), std::move(edges));
     }
 } // namespace gpx
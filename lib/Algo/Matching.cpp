@@ -0,0 +1,249 @@
+#include <Graphexia/Algo/Matching.hpp>
+#include <Graphexia/GraphCSR.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace gpx {
+    static constexpr usize None = std::numeric_limits<usize>::max();
+    static constexpr u8 NoSide = 2;
+
+    BipartitionResult Bipartition(const gpx::Graph& graph) {
+        const std::vector<Edge>& edges = graph.Edges();
+        usize verticesCount = graph.Vertices();
+        GraphCSR csr = CreateCSR(graph, CSRDirection::Both);
+
+        std::vector<u8> sides(verticesCount, NoSide);
+        std::vector<usize> parentEdges(verticesCount, None);
+        std::vector<usize> depths(verticesCount);
+        std::vector<usize> queue;
+        queue.reserve(verticesCount);
+
+        for (usize root = 0; root < verticesCount; ++root) {
+            if(sides[root] != NoSide) {
+                continue;
+            }
+
+            sides[root] = 0;
+            queue.clear();
+            queue.push_back(root);
+
+            for (usize i = 0; i < queue.size(); ++i) {
+                usize v = queue[i];
+                std::span<const usize> adjacent = csr.Adjacent(v);
+                std::span<const usize> adjacentEdges = csr.AdjacentEdges(v);
+
+                for (usize j = 0; j < adjacent.size(); ++j) {
+                    usize w = adjacent[j];
+
+                    if(sides[w] == NoSide) {
+                        sides[w] = sides[v] ^ 1;
+                        parentEdges[w] = adjacentEdges[j];
+                        depths[w] = depths[v] + 1;
+                        queue.push_back(w);
+                        continue;
+                    }
+
+                    if(sides[w] != sides[v]) {
+                        continue;
+                    }
+
+                    // Both tree paths up to the lowest common ancestor plus this edge make an odd cycle
+                    std::vector<usize> fromV, fromW;
+                    usize a = v, b = w;
+
+                    auto climb = [&edges, &parentEdges, &depths](usize& vertex, std::vector<usize>& path) {
+                        const Edge& parent = edges[parentEdges[vertex]];
+
+                        path.push_back(parentEdges[vertex]);
+                        vertex = parent.fromId == vertex ? parent.toId : parent.fromId;
+                    };
+
+                    while(depths[a] > depths[b]) climb(a, fromV);
+                    while(depths[b] > depths[a]) climb(b, fromW);
+                    while(a != b) {
+                        climb(a, fromV);
+                        climb(b, fromW);
+                    }
+
+                    std::vector<usize> oddCycle(fromV.rbegin(), fromV.rend());
+                    oddCycle.push_back(adjacentEdges[j]);
+                    oddCycle.insert(oddCycle.end(), fromW.begin(), fromW.end());
+
+                    return BipartitionResult{false, std::move(sides), std::move(oddCycle)};
+                }
+            }
+        }
+
+        return BipartitionResult{true, std::move(sides), std::vector<usize>()};
+    }
+
+    std::optional<std::vector<usize>> HopcroftKarp(const gpx::Graph& graph) {
+        BipartitionResult bipartition = Bipartition(graph);
+
+        if(!bipartition.bipartite) {
+            return std::nullopt;
+        }
+
+        return HopcroftKarp(graph, bipartition.sides);
+    }
+
+    std::vector<usize> HopcroftKarp(const gpx::Graph& graph, const std::vector<u8>& sides) {
+        const std::vector<Edge>& edges = graph.Edges();
+        usize verticesCount = graph.Vertices();
+        GraphCSR csr = CreateCSR(graph, CSRDirection::Both);
+
+        std::vector<usize> left;
+        for (usize v = 0; v < verticesCount; ++v) {
+            if(sides[v] == 0) {
+                left.push_back(v);
+            }
+        }
+
+        // Matched edge of every vertex, in both sides
+        std::vector<usize> matches(verticesCount, None);
+        auto mate = [&edges, &matches](usize v) {
+            const Edge& edge = edges[matches[v]];
+            return edge.fromId == v ? edge.toId : edge.fromId;
+        };
+
+        // Cheap greedy start, usually leaves very few augmenting phases
+        for (const usize u : left) {
+            std::span<const usize> adjacent = csr.Adjacent(u);
+            std::span<const usize> adjacentEdges = csr.AdjacentEdges(u);
+
+            for (usize j = 0; j < adjacent.size(); ++j) {
+                if(matches[adjacent[j]] == None && adjacent[j] != u) {
+                    matches[u] = adjacentEdges[j];
+                    matches[adjacent[j]] = adjacentEdges[j];
+                    break;
+                }
+            }
+        }
+
+        constexpr usize Infinite = std::numeric_limits<usize>::max();
+        std::vector<usize> distances(verticesCount, Infinite);
+        std::vector<usize> cursors(verticesCount);
+        std::vector<usize> queue;
+        std::vector<usize> stack;
+        queue.reserve(left.size());
+
+        while(true) {
+            // Layer the left vertices by alternating path length from the free ones
+            queue.clear();
+            for (const usize u : left) {
+                if(matches[u] == None) {
+                    distances[u] = 0;
+                    queue.push_back(u);
+                } else {
+                    distances[u] = Infinite;
+                }
+            }
+
+            usize shortest = Infinite;
+            for (usize i = 0; i < queue.size(); ++i) {
+                usize u = queue[i];
+
+                if(distances[u] >= shortest) {
+                    break;
+                }
+
+                for (const usize w : csr.Adjacent(u)) {
+                    if(w == u) {
+                        continue;
+                    }
+
+                    if(matches[w] == None) {
+                        shortest = std::min(shortest, distances[u] + 1);
+                        continue;
+                    }
+
+                    usize next = mate(w);
+                    if(distances[next] == Infinite) {
+                        distances[next] = distances[u] + 1;
+                        queue.push_back(next);
+                    }
+                }
+            }
+
+            if(shortest == Infinite) {
+                break;
+            }
+
+            // Vertex disjoint shortest augmenting paths, iterative DFS with a cursor per vertex
+            for (const usize u : left) {
+                cursors[u] = csr.offsets[u];
+            }
+
+            for (const usize root : left) {
+                if(matches[root] != None || distances[root] != 0) {
+                    continue;
+                }
+
+                stack.clear();
+                stack.push_back(root);
+
+                while(!stack.empty()) {
+                    usize u = stack.back();
+                    usize& cursor = cursors[u];
+
+                    if(cursor == csr.offsets[u + 1]) { // Dead end, never visit it again this phase
+                        distances[u] = Infinite;
+                        stack.pop_back();
+
+                        if(!stack.empty()) {
+                            ++cursors[stack.back()];
+                        }
+                        continue;
+                    }
+
+                    usize w = csr.adjacent[cursor];
+                    if(w == u) {
+                        ++cursor;
+                        continue;
+                    }
+
+                    if(matches[w] == None) {
+                        if(distances[u] + 1 != shortest) {
+                            ++cursor;
+                            continue;
+                        }
+
+                        // Augment, every stack vertex takes the edge its cursor points to
+                        for (const usize pathVertex : stack) {
+                            usize edgeId = csr.edgeIds[cursors[pathVertex]];
+                            usize other = csr.adjacent[cursors[pathVertex]];
+
+                            matches[pathVertex] = edgeId;
+                            matches[other] = edgeId;
+                        }
+
+                        for (const usize pathVertex : stack) {
+                            distances[pathVertex] = Infinite;
+                        }
+
+                        stack.clear();
+                        break;
+                    }
+
+                    usize next = mate(w);
+                    if(distances[next] == distances[u] + 1) {
+                        stack.push_back(next);
+                    } else {
+                        ++cursor;
+                    }
+                }
+            }
+        }
+
+        std::vector<usize> result;
+        for (const usize u : left) {
+            if(matches[u] != None) {
+                result.push_back(matches[u]);
+            }
+        }
+
+        return result;
+    }
+} // namespace gpx
@@ -0,0 +1,352 @@
+#include <Graphexia/Algo/MaxFlow.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace gpx {
+    static constexpr usize None = std::numeric_limits<usize>::max();
+
+    static void PushActive(MaxFlowState& state, usize v) {
+        usize label = state.labels[v];
+
+        state.activeNext[v] = state.activeHeads[label];
+        state.activeHeads[label] = v;
+        state.highestActive = std::max(state.highestActive, label);
+    }
+
+    static void InsertLabel(MaxFlowState& state, usize v) {
+        usize label = state.labels[v];
+
+        state.labelPrevious[v] = None;
+        state.labelNext[v] = state.labelHeads[label];
+
+        if(state.labelHeads[label] != None) {
+            state.labelPrevious[state.labelHeads[label]] = v;
+        }
+
+        state.labelHeads[label] = v;
+    }
+
+    static void RemoveLabel(MaxFlowState& state, usize v) {
+        if(state.labelPrevious[v] != None) {
+            state.labelNext[state.labelPrevious[v]] = state.labelNext[v];
+        } else {
+            state.labelHeads[state.labels[v]] = state.labelNext[v];
+        }
+
+        if(state.labelNext[v] != None) {
+            state.labelPrevious[state.labelNext[v]] = state.labelPrevious[v];
+        }
+    }
+
+    // Exact labels: distance to the sink in the residual network, or n + distance to the source for vertices that can't reach the sink
+    static void GlobalRelabel(MaxFlowState& state) {
+        usize verticesCount = state.labels.size();
+        usize unreachable = 2 * verticesCount;
+
+        std::fill(state.labels.begin(), state.labels.end(), unreachable);
+        std::vector<usize> queue;
+        queue.reserve(verticesCount);
+
+        auto reverseBFS = [&state, &queue, unreachable](usize root, usize base) {
+            queue.clear();
+            queue.push_back(root);
+            state.labels[root] = base;
+
+            for (usize i = 0; i < queue.size(); ++i) {
+                usize w = queue[i];
+
+                for (usize a = state.arcOffsets[w]; a < state.arcOffsets[w + 1]; ++a) {
+                    usize u = state.arcHeads[a];
+
+                    // Can u push into w?
+                    if(state.labels[u] == unreachable && state.residual[state.arcReverse[a]] > 0) {
+                        state.labels[u] = state.labels[w] + 1;
+                        queue.push_back(u);
+                    }
+                }
+            }
+        };
+
+        reverseBFS(state.sink, 0);
+
+        // The source label is fixed
+        state.labels[state.source] = unreachable;
+        reverseBFS(state.source, verticesCount);
+
+        std::fill(state.activeHeads.begin(), state.activeHeads.end(), None);
+        std::fill(state.labelHeads.begin(), state.labelHeads.end(), None);
+        state.highestActive = 0;
+
+        for (usize v = 0; v < verticesCount; ++v) {
+            state.currentArcs[v] = state.arcOffsets[v];
+
+            if(v == state.source || v == state.sink) {
+                continue;
+            }
+
+            if(state.labels[v] < verticesCount) {
+                InsertLabel(state, v);
+            }
+
+            if(state.excess[v] > 0 && state.labels[v] < unreachable) {
+                PushActive(state, v);
+            }
+        }
+
+        state.relabelsSinceGlobal = 0;
+    }
+
+    // Nothing with a label in (gap, n) can reach the sink anymore, lift all of them above n
+    static void Gap(MaxFlowState& state, usize gap) {
+        usize verticesCount = state.labels.size();
+
+        for (usize label = gap + 1; label < verticesCount; ++label) {
+            usize v = state.labelHeads[label];
+
+            while(v != None) {
+                usize next = state.labelNext[v];
+
+                state.labels[v] = verticesCount + 1;
+                v = next;
+            }
+
+            state.labelHeads[label] = None;
+        }
+    }
+
+    static void Relabel(MaxFlowState& state, usize v) {
+        usize verticesCount = state.labels.size();
+        usize oldLabel = state.labels[v];
+        usize newLabel = 2 * verticesCount;
+
+        for (usize a = state.arcOffsets[v]; a < state.arcOffsets[v + 1]; ++a) {
+            if(state.residual[a] > 0 && state.labels[state.arcHeads[a]] + 1 < newLabel) {
+                newLabel = state.labels[state.arcHeads[a]] + 1;
+                state.currentArcs[v] = a;
+            }
+        }
+
+        if(oldLabel < verticesCount) {
+            RemoveLabel(state, v);
+
+            if(state.labelHeads[oldLabel] == None) {
+                Gap(state, oldLabel);
+                newLabel = std::max(newLabel, verticesCount + 1);
+            }
+        }
+
+        state.labels[v] = newLabel;
+        if(newLabel < verticesCount) {
+            InsertLabel(state, v);
+        }
+
+        ++state.relabelsSinceGlobal;
+    }
+
+    MaxFlowState SetupMaxFlow(const gpx::Graph& graph, usize source, usize sink) {
+        const std::vector<Edge>& edges = graph.Edges();
+        usize verticesCount = graph.Vertices();
+
+        std::vector<usize> arcOffsets(verticesCount + 1);
+        for (const Edge& edge : edges) {
+            if(edge.fromId == edge.toId) {
+                continue;
+            }
+
+            ++arcOffsets[edge.fromId + 1];
+            ++arcOffsets[edge.toId + 1];
+        }
+
+        for (usize i = 0; i < verticesCount; ++i) {
+            arcOffsets[i + 1] += arcOffsets[i];
+        }
+
+        usize arcsCount = arcOffsets[verticesCount];
+        std::vector<usize> arcHeads(arcsCount);
+        std::vector<usize> arcReverse(arcsCount);
+        std::vector<usize> arcEdges(arcsCount);
+        std::vector<f64> residual(arcsCount);
+        std::vector<usize> edgeArcs(edges.size(), None);
+        std::vector<usize> cursor(arcOffsets.begin(), arcOffsets.end() - 1);
+
+        for (usize i = 0; i < edges.size(); ++i) {
+            const Edge& edge = edges[i];
+
+            if(edge.fromId == edge.toId) {
+                continue;
+            }
+
+            f64 capacity = std::max(static_cast<f64>(edge.weight), 0.);
+            usize forward = cursor[edge.fromId]++;
+            usize backward = cursor[edge.toId]++;
+
+            arcHeads[forward] = edge.toId;
+            arcReverse[forward] = backward;
+            arcEdges[forward] = i;
+            residual[forward] = capacity;
+
+            arcHeads[backward] = edge.fromId;
+            arcReverse[backward] = forward;
+            arcEdges[backward] = i;
+            residual[backward] = graph.IsDirected() ? 0. : capacity;
+
+            edgeArcs[i] = forward;
+        }
+
+        MaxFlowState state{
+            source, sink,
+            std::move(arcOffsets),
+            std::move(arcHeads),
+            std::move(arcReverse),
+            std::move(arcEdges),
+            std::move(residual),
+            std::move(edgeArcs),
+
+            std::vector<usize>(verticesCount),
+            std::vector<f64>(verticesCount),
+            std::vector<usize>(verticesCount),
+
+            std::vector<usize>(2 * verticesCount + 1, None),
+            std::vector<usize>(verticesCount, None),
+            0,
+
+            std::vector<usize>(verticesCount, None),
+            std::vector<usize>(verticesCount, None),
+            std::vector<usize>(verticesCount, None),
+
+            0,
+            source,
+            std::vector<usize>()
+        };
+
+        if(source == sink) {
+            return state;
+        }
+
+        // Saturate everything leaving the source
+        for (usize a = state.arcOffsets[source]; a < state.arcOffsets[source + 1]; ++a) {
+            f64 delta = state.residual[a];
+
+            if(delta <= 0) {
+                continue;
+            }
+
+            state.residual[a] = 0;
+            state.residual[state.arcReverse[a]] += delta;
+            state.excess[state.arcHeads[a]] += delta;
+            state.excess[source] -= delta;
+        }
+
+        GlobalRelabel(state);
+        return state;
+    }
+
+    bool IterateMaxFlow(const gpx::Graph& graph, MaxFlowState& state) {
+        usize verticesCount = graph.Vertices();
+        state.result.clear();
+
+        if(state.relabelsSinceGlobal > verticesCount) {
+            GlobalRelabel(state);
+        }
+
+        while(state.activeHeads[state.highestActive] == None) {
+            if(state.highestActive == 0) {
+                return true;
+            }
+
+            --state.highestActive;
+        }
+
+        usize v = state.activeHeads[state.highestActive];
+        state.activeHeads[state.highestActive] = state.activeNext[v];
+        state.current = v;
+
+        // Discharge
+        while(state.excess[v] > 0 && state.labels[v] < 2 * verticesCount) {
+            usize a = state.currentArcs[v];
+
+            if(a == state.arcOffsets[v + 1]) {
+                Relabel(state, v);
+                continue;
+            }
+
+            usize w = state.arcHeads[a];
+            if(state.residual[a] <= 0 || state.labels[v] != state.labels[w] + 1) {
+                ++state.currentArcs[v];
+                continue;
+            }
+
+            f64 delta = std::min(state.excess[v], state.residual[a]);
+            state.residual[a] -= delta;
+            state.residual[state.arcReverse[a]] += delta;
+            state.excess[v] -= delta;
+
+            if(state.excess[w] <= 0 && w != state.source && w != state.sink) {
+                PushActive(state, w);
+            }
+
+            state.excess[w] += delta;
+            state.result.push_back(state.arcEdges[a]);
+        }
+
+        return false;
+    }
+
+    MaxFlowResult MaxFlowFromState(const gpx::Graph& graph, const MaxFlowState& state) {
+        const std::vector<Edge>& edges = graph.Edges();
+        std::vector<f64> flows(edges.size());
+
+        for (usize i = 0; i < edges.size(); ++i) {
+            usize arc = state.edgeArcs[i];
+
+            if(arc != None) {
+                flows[i] = std::max(static_cast<f64>(edges[i].weight), 0.) - state.residual[arc];
+            }
+        }
+
+        // Source side of the cut: everything reachable from the source in the residual network
+        std::vector<bool> sourceSide(graph.Vertices());
+        std::vector<usize> queue{state.source};
+        sourceSide[state.source] = true;
+
+        for (usize i = 0; i < queue.size(); ++i) {
+            usize v = queue[i];
+
+            for (usize a = state.arcOffsets[v]; a < state.arcOffsets[v + 1]; ++a) {
+                usize w = state.arcHeads[a];
+
+                if(!sourceSide[w] && state.residual[a] > 0) {
+                    sourceSide[w] = true;
+                    queue.push_back(w);
+                }
+            }
+        }
+
+        std::vector<usize> minCut;
+        for (usize i = 0; i < edges.size(); ++i) {
+            const Edge& edge = edges[i];
+
+            if(sourceSide[edge.fromId] ? !sourceSide[edge.toId] : (sourceSide[edge.toId] && !graph.IsDirected())) {
+                minCut.push_back(i);
+            }
+        }
+
+        return MaxFlowResult{
+            state.source == state.sink ? 0. : state.excess[state.sink],
+            std::move(flows),
+            std::move(minCut)
+        };
+    }
+
+    MaxFlowResult MaxFlow(const gpx::Graph& graph, usize source, usize sink) {
+        MaxFlowState state = SetupMaxFlow(graph, source, sink);
+
+        while(!IterateMaxFlow(graph, state)) {
+            state.result.clear();
+        }
+
+        return MaxFlowFromState(graph, state);
+    }
+} // namespace gpx
@@ -0,0 +1,186 @@
+#include <Graphexia/Algo/Topological.hpp>
+#include <Graphexia/GraphCSR.hpp>
+#include <Graphexia/Parallel.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <vector>
+
+namespace gpx {
+    static constexpr usize None = std::numeric_limits<usize>::max();
+
+    // CreateCSR honours the undirected flag, here edges always go from fromId to toId
+    static GraphCSR CreateForwardCSR(const Graph& graph) {
+        if(graph.IsDirected()) {
+            return CreateCSR(graph, CSRDirection::Outgoing);
+        }
+
+        const std::vector<Edge>& edges = graph.Edges();
+        usize verticesCount = graph.Vertices();
+
+        std::vector<usize> offsets(verticesCount + 1);
+        for (const Edge& edge : edges) {
+            ++offsets[edge.fromId + 1];
+        }
+
+        for (usize i = 0; i < verticesCount; ++i) {
+            offsets[i + 1] += offsets[i];
+        }
+
+        std::vector<usize> adjacent(edges.size());
+        std::vector<usize> edgeIds(edges.size());
+        std::vector<usize> cursor(offsets.begin(), offsets.end() - 1);
+
+        for (usize i = 0; i < edges.size(); ++i) {
+            usize index = cursor[edges[i].fromId]++;
+
+            adjacent[index] = edges[i].toId;
+            edgeIds[index] = i;
+        }
+
+        return GraphCSR{std::move(offsets), std::move(adjacent), std::move(edgeIds)};
+    }
+
+    static std::vector<usize> InDegrees(const Graph& graph) {
+        std::vector<usize> inDegrees(graph.Vertices());
+
+        for (const Edge& edge : graph.Edges()) {
+            ++inDegrees[edge.toId];
+        }
+
+        return inDegrees;
+    }
+
+    // Every vertex left with a positive in degree has an incoming edge from another leftover vertex,
+    // walking those edges backwards must eventually repeat a vertex.
+    static std::vector<usize> WitnessCycle(const Graph& graph, const std::vector<usize>& inDegrees) {
+        const std::vector<Edge>& edges = graph.Edges();
+        usize verticesCount = graph.Vertices();
+
+        std::vector<usize> incomingEdge(verticesCount, None);
+        usize start = None;
+
+        for (usize i = 0; i < edges.size(); ++i) {
+            const Edge& edge = edges[i];
+
+            if(inDegrees[edge.fromId] > 0 && inDegrees[edge.toId] > 0) {
+                incomingEdge[edge.toId] = i;
+                start = edge.toId;
+            }
+        }
+
+        if(start == None) {
+            return {};
+        }
+
+        std::vector<usize> steps(verticesCount, None);
+        std::vector<usize> walk;
+        usize v = start;
+
+        while(steps[v] == None) {
+            steps[v] = walk.size();
+            walk.push_back(incomingEdge[v]);
+            v = edges[incomingEdge[v]].fromId;
+        }
+
+        // walk[steps[v]..] goes backwards around the cycle
+        std::vector<usize> cycle(walk.rbegin(), walk.rend() - steps[v]);
+        return cycle;
+    }
+
+    TopologicalOrder TopologicalSort(const Graph& graph) {
+        usize verticesCount = graph.Vertices();
+        GraphCSR csr = CreateForwardCSR(graph);
+        std::vector<usize> inDegrees = InDegrees(graph);
+
+        std::vector<usize> order;
+        order.reserve(verticesCount);
+
+        for (usize v = 0; v < verticesCount; ++v) {
+            if(inDegrees[v] == 0) {
+                order.push_back(v);
+            }
+        }
+
+        // The order itself is the queue
+        for (usize i = 0; i < order.size(); ++i) {
+            for (const usize w : csr.Adjacent(order[i])) {
+                if(--inDegrees[w] == 0) {
+                    order.push_back(w);
+                }
+            }
+        }
+
+        if(order.size() == verticesCount) {
+            return TopologicalOrder{true, std::move(order), std::vector<usize>()};
+        }
+
+        std::vector<usize> cycle = WitnessCycle(graph, inDegrees);
+        return TopologicalOrder{false, std::move(order), std::move(cycle)};
+    }
+
+    TopologicalLevels TopologicalWavefronts(const Graph& graph, usize threads) {
+        usize verticesCount = graph.Vertices();
+        GraphCSR csr = CreateForwardCSR(graph);
+        std::vector<usize> inDegrees = InDegrees(graph);
+        threads = ResolveThreads(threads);
+
+        std::vector<usize> levels(verticesCount, None);
+        std::vector<usize> frontier;
+
+        for (usize v = 0; v < verticesCount; ++v) {
+            if(inDegrees[v] == 0) {
+                levels[v] = 0;
+                frontier.push_back(v);
+            }
+        }
+
+        std::vector<std::vector<usize>> threadFrontiers(threads);
+        std::vector<usize> levelSizes;
+        usize processed = 0;
+
+        while(!frontier.empty()) {
+            usize nextLevel = levelSizes.size() + 1;
+            levelSizes.push_back(frontier.size());
+            processed += frontier.size();
+
+            ParallelFor(0, frontier.size(), threads, [&](usize begin, usize end, usize thread) {
+                for (usize i = begin; i < end; ++i) {
+                    for (const usize w : csr.Adjacent(frontier[i])) {
+                        // Whoever removes the last incoming edge owns w, so levels[w] has a single writer
+                        if(std::atomic_ref<usize>(inDegrees[w]).fetch_sub(1, std::memory_order_relaxed) == 1) {
+                            levels[w] = nextLevel;
+                            threadFrontiers[thread].push_back(w);
+                        }
+                    }
+                }
+            }, 256);
+
+            frontier.clear();
+            for (std::vector<usize>& threadFrontier : threadFrontiers) {
+                frontier.insert(frontier.end(), threadFrontier.begin(), threadFrontier.end());
+                threadFrontier.clear();
+            }
+        }
+
+        // Counting sort by level, deterministic no matter how the threads raced
+        std::vector<usize> levelOffsets(levelSizes.size() + 1);
+        for (usize i = 0; i < levelSizes.size(); ++i) {
+            levelOffsets[i + 1] = levelOffsets[i] + levelSizes[i];
+        }
+
+        std::vector<usize> vertices(processed);
+        std::vector<usize> cursor(levelOffsets.begin(), levelOffsets.end() - 1);
+        for (usize v = 0; v < verticesCount; ++v) {
+            if(levels[v] != None) {
+                vertices[cursor[levels[v]]++] = v;
+            }
+        }
+
+        bool acyclic = processed == verticesCount;
+        std::vector<usize> cycle = acyclic ? std::vector<usize>() : WitnessCycle(graph, inDegrees);
+
+        return TopologicalLevels{acyclic, std::move(vertices), std::move(levelOffsets), std::move(cycle)};
+    }
+} // namespace gpx
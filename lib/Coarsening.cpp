@@ -0,0 +1,185 @@
+#include <Graphexia/Coarsening.hpp>
+#include <Graphexia/Parallel.hpp>
+#include <Graphexia/Random.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+namespace gpx {
+    static constexpr usize NoParent = std::numeric_limits<usize>::max();
+
+    // Fills level.parents and returns the next coarser level
+    static CoarseningLevel Coarsen(CoarseningLevel& level, usize levelIndex, const CoarseningOptions& options) {
+        const GraphCSR& csr = level.csr;
+        usize verticesCount = csr.Vertices();
+
+        std::vector<usize> order(verticesCount);
+        std::iota(order.begin(), order.end(), usize(0));
+
+        CounterRandom generator(options.seed, levelIndex);
+        for (usize i = verticesCount; i > 1; --i) {
+            std::swap(order[i - 1], order[generator.NextBelow(i)]);
+        }
+
+        std::vector<usize> parents(verticesCount, NoParent);
+        std::vector<f32> coarseWeights;
+
+        // Heavy edge matching, weights are normalized by the size of both endpoints so clusters stay balanced
+        for (const usize v : order) {
+            if(parents[v] != NoParent) {
+                continue;
+            }
+
+            usize best = NoParent;
+            f32 bestScore = 0;
+
+            for (usize i = csr.offsets[v]; i < csr.offsets[v + 1]; ++i) {
+                usize u = csr.adjacent[i];
+                if(u == v || parents[u] != NoParent) {
+                    continue;
+                }
+
+                f32 score = level.entryWeights[i] / (level.vertexWeights[v] * level.vertexWeights[u]);
+                if(best == NoParent || score > bestScore) {
+                    best = u;
+                    bestScore = score;
+                }
+            }
+
+            if(best != NoParent) {
+                parents[v] = parents[best] = coarseWeights.size();
+                coarseWeights.push_back(level.vertexWeights[v] + level.vertexWeights[best]);
+            }
+        }
+
+        // Every neighbour of an unmatched vertex is matched, join the lightest cluster around it
+        for (const usize v : order) {
+            if(parents[v] != NoParent) {
+                continue;
+            }
+
+            usize best = NoParent;
+            for (const usize u : csr.Adjacent(v)) {
+                if(u != v && parents[u] != NoParent && (best == NoParent || coarseWeights[parents[u]] < coarseWeights[best])) {
+                    best = parents[u];
+                }
+            }
+
+            if(best == NoParent) {
+                parents[v] = coarseWeights.size();
+                coarseWeights.push_back(level.vertexWeights[v]);
+                continue;
+            }
+
+            parents[v] = best;
+            coarseWeights[best] += level.vertexWeights[v];
+        }
+
+        usize coarseCount = coarseWeights.size();
+
+        // Vertices grouped by their parent
+        std::vector<usize> memberOffsets(coarseCount + 1);
+        for (const usize parent : parents) {
+            ++memberOffsets[parent + 1];
+        }
+
+        for (usize c = 0; c < coarseCount; ++c) {
+            memberOffsets[c + 1] += memberOffsets[c];
+        }
+
+        std::vector<usize> members(verticesCount);
+        std::vector<usize> cursor(memberOffsets.begin(), memberOffsets.end() - 1);
+        for (usize v = 0; v < verticesCount; ++v) {
+            members[cursor[parents[v]]++] = v;
+        }
+
+        // Every chunk merges the entries of its coarse vertices, dropping the ones that became internal
+        usize threads = ResolveThreads(options.threads);
+        std::vector<std::vector<usize>> adjacentParts(threads);
+        std::vector<std::vector<f32>> weightParts(threads);
+        std::vector<usize> offsets(coarseCount + 1);
+
+        ParallelFor(0, coarseCount, threads, [&](usize begin, usize end, usize thread) {
+            std::vector<std::pair<usize, f32>> entries;
+            std::vector<usize>& adjacent = adjacentParts[thread];
+            std::vector<f32>& weights = weightParts[thread];
+
+            for (usize c = begin; c < end; ++c) {
+                entries.clear();
+
+                for (usize m = memberOffsets[c]; m < memberOffsets[c + 1]; ++m) {
+                    usize v = members[m];
+
+                    for (usize i = csr.offsets[v]; i < csr.offsets[v + 1]; ++i) {
+                        usize target = parents[csr.adjacent[i]];
+                        if(target != c) {
+                            entries.emplace_back(target, level.entryWeights[i]);
+                        }
+                    }
+                }
+
+                std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+                usize degree = 0;
+                for (usize i = 0; i < entries.size(); ++i) {
+                    if(degree != 0 && adjacent.back() == entries[i].first) {
+                        weights.back() += entries[i].second;
+                        continue;
+                    }
+
+                    adjacent.push_back(entries[i].first);
+                    weights.push_back(entries[i].second);
+                    ++degree;
+                }
+
+                offsets[c + 1] = degree;
+            }
+        });
+
+        for (usize c = 0; c < coarseCount; ++c) {
+            offsets[c + 1] += offsets[c];
+        }
+
+        level.parents = std::move(parents);
+
+        return CoarseningLevel{
+            GraphCSR{std::move(offsets), ParallelConcatenate(adjacentParts, threads), std::vector<usize>()},
+            ParallelConcatenate(weightParts, threads),
+            std::move(coarseWeights),
+            std::vector<usize>()
+        };
+    }
+
+    CoarseningHierarchy CreateCoarseningHierarchy(GraphCSR&& csr, const CoarseningOptions& options) {
+        usize verticesCount = csr.Vertices();
+        usize entries = csr.Entries();
+
+        CoarseningHierarchy hierarchy;
+        hierarchy.levels.push_back(CoarseningLevel{std::move(csr), std::vector<f32>(entries, 1.f), std::vector<f32>(verticesCount, 1.f), std::vector<usize>()});
+
+        while(hierarchy.levels.size() < options.maxLevels) {
+            CoarseningLevel& finest = hierarchy.levels.back();
+            usize finestCount = finest.csr.Vertices();
+
+            if(finestCount <= options.minimumVertices || options.stop.stop_requested()) {
+                break;
+            }
+
+            CoarseningLevel coarse = Coarsen(finest, hierarchy.levels.size() - 1, options);
+            if(static_cast<f64>(coarse.csr.Vertices()) > options.maximumRatio * static_cast<f64>(finestCount)) {
+                finest.parents.clear();
+                break;
+            }
+
+            hierarchy.levels.push_back(std::move(coarse));
+        }
+
+        return hierarchy;
+    }
+
+    CoarseningHierarchy CreateCoarseningHierarchy(const Graph& graph, const CoarseningOptions& options) {
+        return CreateCoarseningHierarchy(CreateCSR(graph, CSRDirection::Both), options);
+    }
+} // namespace gpx
@@ -0,0 +1,237 @@
+#include <Graphexia/CompressedGraph.hpp>
+#include <Graphexia/GraphCSR.hpp>
+#include <Graphexia/GraphConcept.hpp>
+#include <Graphexia/Parallel.hpp>
+
+#include <array>
+#include <cstring>
+#include <span>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#define GRAPHEXIA_STREAMVBYTE_SSSE3
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define GRAPHEXIA_STREAMVBYTE_NEON
+#endif
+
+namespace gpx {
+    static_assert(AdjacencyGraph<CompressedGraph>);
+
+    // Data bytes used by the 4 values of a control byte
+    static constexpr std::array<u8, 256> StreamVByteLengths = []() {
+        std::array<u8, 256> lengths{};
+
+        for (usize control = 0; control < 256; ++control) {
+            for (usize k = 0; k < 4; ++k) {
+                lengths[control] += static_cast<u8>(((control >> (2 * k)) & 3) + 1);
+            }
+        }
+
+        return lengths;
+    }();
+
+#if defined(GRAPHEXIA_STREAMVBYTE_SSSE3) || defined(GRAPHEXIA_STREAMVBYTE_NEON)
+    // Byte shuffle that spreads the data of a control byte into 4 u32 lanes, 0x80 zeroes the byte
+    static constexpr std::array<std::array<u8, 16>, 256> StreamVByteShuffles = []() {
+        std::array<std::array<u8, 16>, 256> shuffles{};
+
+        for (usize control = 0; control < 256; ++control) {
+            u8 offset = 0;
+
+            for (usize k = 0; k < 4; ++k) {
+                usize length = ((control >> (2 * k)) & 3) + 1;
+
+                for (usize b = 0; b < 4; ++b) {
+                    shuffles[control][4 * k + b] = b < length ? static_cast<u8>(offset + b) : 0x80;
+                }
+
+                offset += static_cast<u8>(length);
+            }
+        }
+
+        return shuffles;
+    }();
+#endif
+
+    static usize ByteLength(u32 value) {
+        return value < (1u << 8) ? 1 : value < (1u << 16) ? 2 : value < (1u << 24) ? 3 : 4;
+    }
+
+    static usize VarintLength(usize value) {
+        usize length = 1;
+        for (; value >= 0x80; value >>= 7) {
+            ++length;
+        }
+        return length;
+    }
+
+    static u8* WriteVarint(u8* cursor, usize value) {
+        for (; value >= 0x80; value >>= 7) {
+            *cursor++ = static_cast<u8>(value | 0x80);
+        }
+
+        *cursor++ = static_cast<u8>(value);
+        return cursor;
+    }
+
+    const u8* DecodeStreamVByte(const u8* control, const u8* data, u32* out, usize count) {
+        usize groups = count / 4;
+
+        for (usize g = 0; g < groups; ++g) {
+            u8 bits = control[g];
+
+#if defined(GRAPHEXIA_STREAMVBYTE_SSSE3)
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+            __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(StreamVByteShuffles[bits].data()));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4 * g), _mm_shuffle_epi8(bytes, shuffle));
+#elif defined(GRAPHEXIA_STREAMVBYTE_NEON)
+            uint8x16_t bytes = vld1q_u8(data);
+            uint8x16_t shuffle = vld1q_u8(StreamVByteShuffles[bits].data());
+            vst1q_u8(reinterpret_cast<u8*>(out + 4 * g), vqtbl1q_u8(bytes, shuffle));
+#else
+            const u8* cursor = data;
+            for (usize k = 0; k < 4; ++k) {
+                usize length = ((bits >> (2 * k)) & 3) + 1;
+                u32 value = 0;
+
+                for (usize b = 0; b < length; ++b) {
+                    value |= static_cast<u32>(cursor[b]) << (8 * b);
+                }
+
+                out[4 * g + k] = value;
+                cursor += length;
+            }
+#endif
+
+            data += StreamVByteLengths[bits];
+        }
+
+        // Last incomplete group
+        for (usize k = 0; k < count % 4; ++k) {
+            usize length = ((control[groups] >> (2 * k)) & 3) + 1;
+            u32 value = 0;
+
+            for (usize b = 0; b < length; ++b) {
+                value |= static_cast<u32>(data[b]) << (8 * b);
+            }
+
+            out[4 * groups + k] = value;
+            data += length;
+        }
+
+        return data;
+    }
+
+    const u8* CompressedGraph::Block(usize id) const {
+        usize checkpoint = id / CheckpointInterval;
+        const u8* cursor = this->data.data() + this->checkpoints[checkpoint];
+
+        // Skipping a list only needs its control bytes
+        for (usize i = checkpoint * CheckpointInterval; i < id; ++i) {
+            usize degree = ReadVarint(cursor);
+            usize controls = (degree + 3) / 4;
+
+            usize length = 0;
+            for (usize c = 0; c < controls; ++c) {
+                length += StreamVByteLengths[cursor[c]];
+            }
+
+            // The unused codes of the last control byte are 0, one byte each
+            if(degree % 4 != 0) {
+                length -= 4 - degree % 4;
+            }
+
+            cursor += controls + length;
+        }
+
+        return cursor;
+    }
+
+    usize CompressedGraph::Degree(usize id) const {
+        const u8* block = this->Block(id);
+        return ReadVarint(block);
+    }
+
+    std::vector<usize> CompressedGraph::Adjacent(usize id) const {
+        std::vector<usize> adjacent;
+        adjacent.reserve(this->Degree(id));
+
+        this->ForEachAdjacent(id, [&adjacent](usize vertex, usize) { adjacent.push_back(vertex); });
+        return adjacent;
+    }
+
+    // Gap of every entry of a sorted list, the first one zig-zag encoded relative to the vertex
+    static u32 GapAt(std::span<const usize> adjacent, usize vertex, usize i) {
+        if(i == 0) {
+            return adjacent[0] >= vertex ? static_cast<u32>(2 * (adjacent[0] - vertex)) : static_cast<u32>(2 * (vertex - adjacent[0]) - 1);
+        }
+
+        return static_cast<u32>(adjacent[i] - adjacent[i - 1]);
+    }
+
+    std::optional<CompressedGraph> CompressGraph(const Graph& graph, usize threads) {
+        usize verticesCount = graph.Vertices();
+
+        if(verticesCount >= (usize(1) << 31)) {
+            return std::nullopt;
+        }
+
+        GraphCSR csr = CreateCSR(graph, CSRDirection::Outgoing);
+        csr.edgeIds = std::vector<usize>();
+
+        // Sort every list and measure its encoding, then place them with a prefix sum and encode them in parallel
+        std::vector<u64> offsets(verticesCount + 1);
+        ParallelFor(0, verticesCount, threads, [&csr, &offsets](usize begin, usize end, usize) {
+            for (usize v = begin; v < end; ++v) {
+                std::sort(csr.adjacent.begin() + csr.offsets[v], csr.adjacent.begin() + csr.offsets[v + 1]);
+
+                std::span<const usize> adjacent = csr.Adjacent(v);
+                usize size = VarintLength(adjacent.size()) + (adjacent.size() + 3) / 4;
+
+                for (usize i = 0; i < adjacent.size(); ++i) {
+                    size += ByteLength(GapAt(adjacent, v, i));
+                }
+
+                offsets[v + 1] = size;
+            }
+        });
+
+        for (usize v = 0; v < verticesCount; ++v) {
+            offsets[v + 1] += offsets[v];
+        }
+
+        CompressedGraph compressed;
+        compressed.vertices = verticesCount;
+        compressed.entries = csr.Entries();
+        compressed.directed = graph.IsDirected();
+        compressed.data.resize(offsets[verticesCount] + CompressedGraph::Padding);
+
+        compressed.checkpoints.resize((verticesCount + CompressedGraph::CheckpointInterval - 1) / CompressedGraph::CheckpointInterval);
+        for (usize i = 0; i < compressed.checkpoints.size(); ++i) {
+            compressed.checkpoints[i] = offsets[i * CompressedGraph::CheckpointInterval];
+        }
+
+        ParallelFor(0, verticesCount, threads, [&csr, &offsets, &compressed](usize begin, usize end, usize) {
+            for (usize v = begin; v < end; ++v) {
+                std::span<const usize> adjacent = csr.Adjacent(v);
+
+                u8* control = WriteVarint(compressed.data.data() + offsets[v], adjacent.size());
+                u8* values = control + (adjacent.size() + 3) / 4;
+                std::memset(control, 0, (adjacent.size() + 3) / 4);
+
+                for (usize i = 0; i < adjacent.size(); ++i) {
+                    u32 gap = GapAt(adjacent, v, i);
+                    usize length = ByteLength(gap);
+
+                    control[i / 4] |= static_cast<u8>((length - 1) << (2 * (i % 4)));
+                    for (usize b = 0; b < length; ++b) {
+                        *values++ = static_cast<u8>(gap >> (8 * b));
+                    }
+                }
+            }
+        });
+
+        return compressed;
+    }
+} // namespace gpx
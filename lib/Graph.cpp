@@ -1,6 +1,29 @@
 #include <Graphexia/Graph.hpp>
 
 namespace gpx {
+    Graph::Graph(usize vertices, std::vector<Edge>&& edges)
+        : vertices(vertices), edges(std::move(edges)), edgesForVertex(vertices), directed() {
+        std::vector<usize> degrees(vertices);
+
+        for (const Edge& edge : this->edges) {
+            assert(edge.fromId < vertices && edge.toId < vertices);
+
+            ++degrees[edge.fromId];
+            ++degrees[edge.toId];
+        }
+
+        for (usize i = 0; i < vertices; ++i) {
+            this->edgesForVertex[i].reserve(degrees[i]);
+        }
+
+        for (usize i = 0; i < this->edges.size(); ++i) {
+            const Edge& edge = this->edges[i];
+
+            this->edgesForVertex[edge.fromId].push_back(i);
+            this->edgesForVertex[edge.toId].push_back(i);
+        }
+    }
+
     // FIXME: Think about this... deleting a vertex takes too much effort.
 
     void Graph::EraseEdge(usize id) {
@@ -0,0 +1,94 @@
+#include <Graphexia/GraphCSR.hpp>
+
+#include <algorithm>
+
+namespace gpx {
+    GraphCSR CreateCSR(const Graph& graph, CSRDirection direction) {
+        const std::vector<Edge>& edges = graph.Edges();
+        const bool directed = graph.IsDirected() && direction != CSRDirection::Both;
+        const bool incoming = direction == CSRDirection::Incoming;
+
+        usize verticesCount = graph.Vertices();
+        std::vector<usize> offsets(verticesCount + 1);
+
+        // Counting sort by source vertex, first count and then scatter
+        for (const Edge& edge : edges) {
+            if(directed) {
+                ++offsets[(incoming ? edge.toId : edge.fromId) + 1];
+                continue;
+            }
+
+            ++offsets[edge.fromId + 1];
+            ++offsets[edge.toId + 1];
+        }
+
+        for (usize i = 0; i < verticesCount; ++i) {
+            offsets[i + 1] += offsets[i];
+        }
+
+        std::vector<usize> adjacent(offsets[verticesCount]);
+        std::vector<usize> edgeIds(offsets[verticesCount]);
+        std::vector<usize> cursor(offsets.begin(), offsets.end() - 1);
+
+        for (usize i = 0; i < edges.size(); ++i) {
+            const Edge& edge = edges[i];
+
+            if(directed) {
+                usize source = incoming ? edge.toId : edge.fromId;
+                usize index = cursor[source]++;
+
+                adjacent[index] = incoming ? edge.fromId : edge.toId;
+                edgeIds[index] = i;
+                continue;
+            }
+
+            usize fromIndex = cursor[edge.fromId]++;
+            adjacent[fromIndex] = edge.toId;
+            edgeIds[fromIndex] = i;
+
+            usize toIndex = cursor[edge.toId]++;
+            adjacent[toIndex] = edge.fromId;
+            edgeIds[toIndex] = i;
+        }
+
+        return GraphCSR{
+            std::move(offsets),
+            std::move(adjacent),
+            std::move(edgeIds)
+        };
+    }
+
+    std::vector<usize> BalancedBounds(const GraphCSR& csr, usize parts) {
+        usize verticesCount = csr.Vertices();
+        parts = std::max<usize>(std::min(parts, verticesCount), 1);
+
+        std::vector<usize> bounds;
+        bounds.reserve(parts + 1);
+        bounds.push_back(0);
+
+        // Weight every vertex as (entries + 1) so vertices without neighbours still cost something
+        usize total = csr.Entries() + verticesCount;
+        for (usize i = 1; i < parts; ++i) {
+            usize target = (total * i) / parts;
+
+            // First vertex v where offsets[v] + v >= target
+            usize low = bounds.back(), high = verticesCount;
+            while(low < high) {
+                usize middle = low + ((high - low) >> 1);
+
+                if(csr.offsets[middle] + middle < target) {
+                    low = middle + 1;
+                } else {
+                    high = middle;
+                }
+            }
+
+            if(low > bounds.back() && low < verticesCount) {
+                bounds.push_back(low);
+            }
+        }
+
+        bounds.push_back(verticesCount);
+        return bounds;
+    }
+} // namespace gpx
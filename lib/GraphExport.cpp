@@ -0,0 +1,187 @@
+#include <Graphexia/GraphExport.hpp>
+#include <Graphexia/BufferedSink.hpp>
+
+#include <vector>
+
+namespace gpx {
+    // Inside a double quoted DOT string only quotes and backslashes need escaping
+    static void WriteDOTString(BufferedSink& sink, std::string_view text) {
+        sink.Write('"');
+
+        for (const char character : text) {
+            if(character == '"' || character == '\\') {
+                sink.Write('\\');
+            }
+
+            sink.Write(character);
+        }
+
+        sink.Write('"');
+    }
+
+    static void WriteXMLText(BufferedSink& sink, std::string_view text) {
+        for (const char character : text) {
+            switch(character) {
+                case '&': sink.Write("&amp;"); break;
+                case '<': sink.Write("&lt;"); break;
+                case '>': sink.Write("&gt;"); break;
+                case '"': sink.Write("&quot;"); break;
+                case '\'': sink.Write("&apos;"); break;
+                default: sink.Write(character); break;
+            }
+        }
+    }
+
+    bool ExportDOT(std::ostream& stream, const Graph& graph, const VertexAttributes& attributes) {
+        BufferedSink sink(stream);
+        usize verticesCount = graph.Vertices();
+        bool hasPositions = attributes.HasPositions(verticesCount);
+        bool hasLabels = attributes.HasLabels(verticesCount);
+        std::string_view connector = graph.IsDirected() ? " -> " : " -- ";
+
+        sink.Write(graph.IsDirected() ? "digraph G {\n" : "graph G {\n");
+
+        for (usize v = 0; v < verticesCount; ++v) {
+            sink.Write("  ");
+            sink.WriteNumber(v);
+
+            if(hasPositions || hasLabels) {
+                sink.Write(" [");
+
+                if(hasLabels) {
+                    sink.Write("label=");
+                    WriteDOTString(sink, attributes.labels[v]);
+                }
+
+                if(hasPositions) {
+                    sink.Write(hasLabels ? " pos=\"" : "pos=\"");
+                    sink.WriteNumber(attributes.positions[2 * v]);
+                    sink.Write(',');
+                    sink.WriteNumber(attributes.positions[2 * v + 1]);
+                    sink.Write("!\"");
+                }
+
+                sink.Write(']');
+            }
+
+            sink.Write(";\n");
+        }
+
+        for (const Edge& edge : graph.Edges()) {
+            sink.Write("  ");
+            sink.WriteNumber(edge.fromId);
+            sink.Write(connector);
+            sink.WriteNumber(edge.toId);
+
+            if(edge.weight != 0) {
+                sink.Write(" [weight=");
+                sink.WriteNumber(edge.weight);
+                sink.Write(']');
+            }
+
+            sink.Write(";\n");
+        }
+
+        sink.Write("}\n");
+        return sink.Flush();
+    }
+
+    bool ExportGraphML(std::ostream& stream, const Graph& graph, const VertexAttributes& attributes) {
+        BufferedSink sink(stream);
+        usize verticesCount = graph.Vertices();
+        bool hasPositions = attributes.HasPositions(verticesCount);
+        bool hasLabels = attributes.HasLabels(verticesCount);
+
+        sink.Write("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                   "<graphml xmlns=\"http://graphml.graphdrawing.org/xmlns\">\n");
+
+        if(hasLabels) {
+            sink.Write("  <key id=\"label\" for=\"node\" attr.name=\"label\" attr.type=\"string\"/>\n");
+        }
+
+        if(hasPositions) {
+            sink.Write("  <key id=\"x\" for=\"node\" attr.name=\"x\" attr.type=\"float\"/>\n"
+                       "  <key id=\"y\" for=\"node\" attr.name=\"y\" attr.type=\"float\"/>\n");
+        }
+
+        sink.Write("  <key id=\"weight\" for=\"edge\" attr.name=\"weight\" attr.type=\"float\"><default>0</default></key>\n");
+        sink.Write(graph.IsDirected() ? "  <graph id=\"G\" edgedefault=\"directed\">\n" : "  <graph id=\"G\" edgedefault=\"undirected\">\n");
+
+        for (usize v = 0; v < verticesCount; ++v) {
+            sink.Write("    <node id=\"n");
+            sink.WriteNumber(v);
+
+            if(!hasPositions && !hasLabels) {
+                sink.Write("\"/>\n");
+                continue;
+            }
+
+            sink.Write("\">");
+
+            if(hasLabels) {
+                sink.Write("<data key=\"label\">");
+                WriteXMLText(sink, attributes.labels[v]);
+                sink.Write("</data>");
+            }
+
+            if(hasPositions) {
+                sink.Write("<data key=\"x\">");
+                sink.WriteNumber(attributes.positions[2 * v]);
+                sink.Write("</data><data key=\"y\">");
+                sink.WriteNumber(attributes.positions[2 * v + 1]);
+                sink.Write("</data>");
+            }
+
+            sink.Write("</node>\n");
+        }
+
+        const std::vector<Edge>& edges = graph.Edges();
+        for (usize i = 0; i < edges.size(); ++i) {
+            const Edge& edge = edges[i];
+
+            sink.Write("    <edge id=\"e");
+            sink.WriteNumber(i);
+            sink.Write("\" source=\"n");
+            sink.WriteNumber(edge.fromId);
+            sink.Write("\" target=\"n");
+            sink.WriteNumber(edge.toId);
+
+            if(edge.weight == 0) {
+                sink.Write("\"/>\n");
+                continue;
+            }
+
+            sink.Write("\"><data key=\"weight\">");
+            sink.WriteNumber(edge.weight);
+            sink.Write("</data></edge>\n");
+        }
+
+        sink.Write("  </graph>\n</graphml>\n");
+        return sink.Flush();
+    }
+
+    bool ExportEdgeList(std::ostream& stream, const Graph& graph, bool weights) {
+        BufferedSink sink(stream);
+
+        sink.Write(graph.IsDirected() ? "# Directed graph, vertices: " : "# Undirected graph, vertices: ");
+        sink.WriteNumber(graph.Vertices());
+        sink.Write(" edges: ");
+        sink.WriteNumber(graph.Edges().size());
+        sink.Write('\n');
+
+        for (const Edge& edge : graph.Edges()) {
+            sink.WriteNumber(edge.fromId);
+            sink.Write(' ');
+            sink.WriteNumber(edge.toId);
+
+            if(weights && edge.weight != 0) {
+                sink.Write(' ');
+                sink.WriteNumber(edge.weight);
+            }
+
+            sink.Write('\n');
+        }
+
+        return sink.Flush();
+    }
+} // namespace gpx
@@ -0,0 +1,297 @@
+#include <Graphexia/GraphFile.hpp>
+#include <Graphexia/GraphCSR.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <fstream>
+#include <type_traits>
+#include <vector>
+
+namespace gpx {
+    static_assert(std::is_trivially_copyable_v<GraphFileHeader>);
+    static_assert(sizeof(GraphFileHeader) % 8 == 0);
+
+    static constexpr u64 AlignUp(u64 value) {
+        return (value + GraphFileAlignment - 1) & ~(GraphFileAlignment - 1);
+    }
+
+    // Writes 'count' values produced by value(i) as T, staged in a small buffer so usize arrays can be stored as u64 anywhere
+    template<typename T, typename Value>
+    static void WriteValues(std::ofstream& stream, usize count, Value&& value) {
+        constexpr usize Staging = 1 << 14;
+        std::vector<T> buffer(std::min(count, Staging));
+
+        for (usize begin = 0; begin < count; begin += Staging) {
+            usize end = std::min(count, begin + Staging);
+
+            for (usize i = begin; i < end; ++i) {
+                buffer[i - begin] = static_cast<T>(value(i));
+            }
+
+            stream.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>((end - begin) * sizeof(T)));
+        }
+    }
+
+    static void PadTo(std::ofstream& stream, u64 offset) {
+        static constexpr char zeros[GraphFileAlignment] = {};
+        u64 position = static_cast<u64>(stream.tellp());
+
+        if(position < offset) {
+            stream.write(zeros, static_cast<std::streamsize>(offset - position));
+        }
+    }
+
+    bool WriteGraphFile(const std::filesystem::path& path, const Graph& graph, const VertexAttributes& attributes, const EdgeAttributes& edgeAttributes) {
+        if constexpr (std::endian::native != std::endian::little) {
+            return false;
+        }
+
+        usize verticesCount = graph.Vertices();
+        const std::vector<Edge>& edges = graph.Edges();
+
+        bool hasPositions = attributes.HasPositions(verticesCount);
+        bool hasLabels = attributes.HasLabels(verticesCount);
+        bool hasVertexColors = attributes.HasColors(verticesCount);
+        bool hasEdgeColors = edgeAttributes.HasColors(edges.size());
+
+        GraphCSR csr = CreateCSR(graph, CSRDirection::Outgoing);
+
+        u64 labelBytes = 0;
+        if(hasLabels) {
+            for (const std::string_view label : attributes.labels) {
+                labelBytes += label.size();
+            }
+        }
+
+        GraphFileHeader header{};
+        header.magic = GraphFileMagic;
+        header.version = GraphFileVersion;
+        header.flags = (graph.IsDirected() ? GraphFileFlags::Directed : GraphFileFlags::None)
+            | (hasPositions ? GraphFileFlags::Positions : GraphFileFlags::None)
+            | (hasLabels ? GraphFileFlags::Labels : GraphFileFlags::None)
+            | (hasVertexColors ? GraphFileFlags::VertexColors : GraphFileFlags::None)
+            | (hasEdgeColors ? GraphFileFlags::EdgeColors : GraphFileFlags::None);
+        header.vertices = verticesCount;
+        header.edges = edges.size();
+        header.entries = csr.Entries();
+
+        std::array<u64, static_cast<usize>(GraphFileSection::Count)> sizes = {
+            (verticesCount + 1) * sizeof(u64),
+            csr.Entries() * sizeof(u64),
+            csr.Entries() * sizeof(u64),
+            2 * edges.size() * sizeof(u64),
+            edges.size() * sizeof(f32),
+            hasPositions ? 2 * verticesCount * sizeof(f32) : 0,
+            hasLabels ? (verticesCount + 1) * sizeof(u64) : 0,
+            labelBytes,
+            hasVertexColors ? verticesCount * sizeof(u32) : 0,
+            hasEdgeColors ? edges.size() * sizeof(u32) : 0
+        };
+
+        u64 offset = AlignUp(sizeof(GraphFileHeader));
+        for (usize i = 0; i < sizes.size(); ++i) {
+            header.sections[i] = GraphFileRange{sizes[i] ? offset : 0, sizes[i]};
+            offset = AlignUp(offset + sizes[i]);
+        }
+
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+        if(!stream) {
+            return false;
+        }
+
+        auto section = [&header](GraphFileSection section) { return header.sections[static_cast<usize>(section)].offset; };
+
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        PadTo(stream, section(GraphFileSection::Offsets));
+        WriteValues<u64>(stream, verticesCount + 1, [&csr](usize i) { return csr.offsets[i]; });
+        PadTo(stream, section(GraphFileSection::Adjacent));
+        WriteValues<u64>(stream, csr.Entries(), [&csr](usize i) { return csr.adjacent[i]; });
+        PadTo(stream, section(GraphFileSection::EdgeIds));
+        WriteValues<u64>(stream, csr.Entries(), [&csr](usize i) { return csr.edgeIds[i]; });
+        PadTo(stream, section(GraphFileSection::Endpoints));
+        WriteValues<u64>(stream, 2 * edges.size(), [&edges](usize i) { return (i & 1) ? edges[i >> 1].toId : edges[i >> 1].fromId; });
+        PadTo(stream, section(GraphFileSection::Weights));
+        WriteValues<f32>(stream, edges.size(), [&edges](usize i) { return edges[i].weight; });
+
+        if(hasPositions) {
+            PadTo(stream, section(GraphFileSection::Positions));
+            stream.write(reinterpret_cast<const char*>(attributes.positions.data()), static_cast<std::streamsize>(attributes.positions.size_bytes()));
+        }
+
+        if(hasLabels) {
+            PadTo(stream, section(GraphFileSection::LabelOffsets));
+
+            u64 labelOffset = 0;
+            WriteValues<u64>(stream, verticesCount + 1, [&attributes, &labelOffset](usize i) {
+                u64 current = labelOffset;
+                if(i < attributes.labels.size()) {
+                    labelOffset += attributes.labels[i].size();
+                }
+                return current;
+            });
+
+            PadTo(stream, section(GraphFileSection::LabelData));
+            for (const std::string_view label : attributes.labels) {
+                stream.write(label.data(), static_cast<std::streamsize>(label.size()));
+            }
+        }
+
+        if(hasVertexColors) {
+            PadTo(stream, section(GraphFileSection::VertexColors));
+            stream.write(reinterpret_cast<const char*>(attributes.colors.data()), static_cast<std::streamsize>(attributes.colors.size_bytes()));
+        }
+
+        if(hasEdgeColors) {
+            PadTo(stream, section(GraphFileSection::EdgeColors));
+            stream.write(reinterpret_cast<const char*>(edgeAttributes.colors.data()), static_cast<std::streamsize>(edgeAttributes.colors.size_bytes()));
+        }
+
+        return static_cast<bool>(stream);
+    }
+
+    std::optional<MappedGraph> MappedGraph::Open(const std::filesystem::path& path) {
+        if constexpr (std::endian::native != std::endian::little) {
+            return std::nullopt;
+        }
+
+        std::optional<MappedFile> file = MappedFile::Open(path);
+        if(!file || file->Size() < sizeof(GraphFileHeader)) {
+            return std::nullopt;
+        }
+
+        MappedGraph graph(std::move(*file));
+        const GraphFileHeader* header = reinterpret_cast<const GraphFileHeader*>(graph.file.Data());
+
+        if(header->magic != GraphFileMagic || header->version != GraphFileVersion) {
+            return std::nullopt;
+        }
+
+        // Sizes of every section must agree with the header and lie inside the file, the contents are not looked at
+        u64 vertices = header->vertices, edges = header->edges, entries = header->entries;
+        bool hasPositions = (header->flags & GraphFileFlags::Positions) != GraphFileFlags::None;
+        bool hasLabels = (header->flags & GraphFileFlags::Labels) != GraphFileFlags::None;
+        bool hasVertexColors = (header->flags & GraphFileFlags::VertexColors) != GraphFileFlags::None;
+        bool hasEdgeColors = (header->flags & GraphFileFlags::EdgeColors) != GraphFileFlags::None;
+
+        if(vertices >= (u64(1) << 48) || edges >= (u64(1) << 48) || entries >= (u64(1) << 48)) {
+            return std::nullopt;
+        }
+
+        std::array<u64, static_cast<usize>(GraphFileSection::Count)> expected = {
+            (vertices + 1) * sizeof(u64),
+            entries * sizeof(u64),
+            entries * sizeof(u64),
+            2 * edges * sizeof(u64),
+            edges * sizeof(f32),
+            hasPositions ? 2 * vertices * sizeof(f32) : 0,
+            hasLabels ? (vertices + 1) * sizeof(u64) : 0,
+            header->sections[static_cast<usize>(GraphFileSection::LabelData)].size,
+            hasVertexColors ? vertices * sizeof(u32) : 0,
+            hasEdgeColors ? edges * sizeof(u32) : 0
+        };
+
+        for (usize i = 0; i < expected.size(); ++i) {
+            const GraphFileRange& range = header->sections[i];
+
+            if(range.size != expected[i]) {
+                return std::nullopt;
+            }
+
+            if(range.size != 0 && (range.offset % GraphFileAlignment != 0 || range.offset > graph.file.Size() || range.size > graph.file.Size() - range.offset)) {
+                return std::nullopt;
+            }
+        }
+
+        auto bytes = [&graph, header](GraphFileSection section) { return graph.file.Data() + header->sections[static_cast<usize>(section)].offset; };
+
+        graph.header = header;
+        graph.offsets = std::span<const u64>(reinterpret_cast<const u64*>(bytes(GraphFileSection::Offsets)), vertices + 1);
+        graph.adjacent = std::span<const u64>(reinterpret_cast<const u64*>(bytes(GraphFileSection::Adjacent)), entries);
+        graph.edgeIds = std::span<const u64>(reinterpret_cast<const u64*>(bytes(GraphFileSection::EdgeIds)), entries);
+        graph.endpoints = std::span<const u64>(reinterpret_cast<const u64*>(bytes(GraphFileSection::Endpoints)), 2 * edges);
+        graph.weights = std::span<const f32>(reinterpret_cast<const f32*>(bytes(GraphFileSection::Weights)), edges);
+
+        if(hasPositions) {
+            graph.positions = std::span<const f32>(reinterpret_cast<const f32*>(bytes(GraphFileSection::Positions)), 2 * vertices);
+        }
+
+        if(hasLabels) {
+            graph.labelOffsets = std::span<const u64>(reinterpret_cast<const u64*>(bytes(GraphFileSection::LabelOffsets)), vertices + 1);
+            graph.labelData = std::span<const char>(reinterpret_cast<const char*>(bytes(GraphFileSection::LabelData)), header->sections[static_cast<usize>(GraphFileSection::LabelData)].size);
+        }
+
+        if(hasVertexColors) {
+            graph.vertexColors = std::span<const u32>(reinterpret_cast<const u32*>(bytes(GraphFileSection::VertexColors)), vertices);
+        }
+
+        if(hasEdgeColors) {
+            graph.edgeColors = std::span<const u32>(reinterpret_cast<const u32*>(bytes(GraphFileSection::EdgeColors)), edges);
+        }
+
+        if(graph.offsets.front() != 0 || graph.offsets.back() != entries) {
+            return std::nullopt;
+        }
+
+        return graph;
+    }
+
+    std::string_view MappedGraph::Label(usize id) const {
+        if(this->labelOffsets.empty()) {
+            return std::string_view();
+        }
+
+        u64 begin = std::min<u64>(this->labelOffsets[id], this->labelData.size());
+        u64 end = std::clamp<u64>(this->labelOffsets[id + 1], begin, this->labelData.size());
+        return std::string_view(this->labelData.data() + begin, end - begin);
+    }
+
+    bool MappedGraph::Validate() const {
+        u64 vertices = this->Vertices();
+
+        for (usize i = 0; i < vertices; ++i) {
+            if(this->offsets[i] > this->offsets[i + 1]) {
+                return false;
+            }
+        }
+
+        for (usize i = 0; i < this->adjacent.size(); ++i) {
+            if(this->adjacent[i] >= vertices || this->edgeIds[i] >= this->EdgeCount()) {
+                return false;
+            }
+        }
+
+        for (const u64 endpoint : this->endpoints) {
+            if(endpoint >= vertices) {
+                return false;
+            }
+        }
+
+        if(!this->labelOffsets.empty()) {
+            for (usize i = 0; i < vertices; ++i) {
+                if(this->labelOffsets[i] > this->labelOffsets[i + 1]) {
+                    return false;
+                }
+            }
+
+            if(this->labelOffsets.back() > this->labelData.size()) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    Graph MappedGraph::ToGraph() const {
+        usize edgesCount = this->EdgeCount();
+
+        std::vector<Edge> edges(edgesCount);
+        for (usize i = 0; i < edgesCount; ++i) {
+            edges[i] = this->EdgeAt(i);
+        }
+
+        Graph graph(this->Vertices(), std::move(edges));
+        graph.SetDirected(this->IsDirected());
+        return graph;
+    }
+} // namespace gpx
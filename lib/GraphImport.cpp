@@ -0,0 +1,468 @@
+#include <Graphexia/GraphImport.hpp>
+#include <Graphexia/MappedFile.hpp>
+#include <Graphexia/Parallel.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstring>
+#include <vector>
+
+namespace gpx {
+    // Smaller inputs are not worth splitting
+    static constexpr usize MinimumChunkBytes = 1 << 20;
+
+    // Reads whitespace separated tokens of one line at a time, never past its end
+    struct LineCursor {
+        const char* current;
+        const char* end;
+
+        void SkipBlanks() {
+            while(this->current < this->end && (*this->current == ' ' || *this->current == '\t' || *this->current == '\r')) {
+                ++this->current;
+            }
+        }
+
+        // First character of the next token or '\n' at the end of the line / input
+        char Peek() {
+            this->SkipBlanks();
+            return this->current < this->end ? *this->current : '\n';
+        }
+
+        bool LineEnded() { return this->Peek() == '\n'; }
+
+        void NextLine() {
+            const char* newline = static_cast<const char*>(std::memchr(this->current, '\n', this->end - this->current));
+            this->current = newline ? newline + 1 : this->end;
+        }
+
+        bool Done() const { return this->current >= this->end; }
+
+        template<typename T>
+        bool Read(T& value) {
+            this->SkipBlanks();
+
+            auto [next, error] = std::from_chars(this->current, this->end, value);
+            if(error != std::errc() || (next < this->end && *next != ' ' && *next != '\t' && *next != '\r' && *next != '\n')) {
+                return false;
+            }
+
+            this->current = next;
+            return true;
+        }
+
+        std::string_view Token() {
+            this->SkipBlanks();
+
+            const char* begin = this->current;
+            while(this->current < this->end && *this->current != ' ' && *this->current != '\t' && *this->current != '\r' && *this->current != '\n') {
+                ++this->current;
+            }
+
+            return std::string_view(begin, this->current - begin);
+        }
+    };
+
+    // Splits text in newline aligned chunks, at most a few per thread
+    static std::vector<usize> LineChunks(std::string_view text, usize threads) {
+        usize parts = std::clamp<usize>(text.size() / MinimumChunkBytes, 1, ResolveThreads(threads) * 4);
+
+        std::vector<usize> bounds{0};
+        for (usize i = 1; i < parts; ++i) {
+            usize position = std::max(text.size() / parts * i, bounds.back());
+            usize newline = text.find('\n', position);
+
+            if(newline == std::string_view::npos) {
+                break;
+            }
+
+            if(newline + 1 > bounds.back() && newline + 1 < text.size()) {
+                bounds.push_back(newline + 1);
+            }
+        }
+
+        bounds.push_back(text.size());
+        return bounds;
+    }
+
+    // Calls parse(chunk, cursor, edges) for every chunk in parallel and joins the edges in file order.
+    // Any chunk returning false fails everything.
+    template<typename Parse>
+    static std::optional<std::vector<Edge>> ParseChunks(std::string_view text, const std::vector<usize>& bounds, usize threads, Parse&& parse) {
+        usize chunks = bounds.size() - 1;
+        std::vector<std::vector<Edge>> chunkEdges(chunks);
+        std::atomic<bool> failed = false;
+
+        ParallelFor(0, chunks, threads, [&](usize begin, usize end, usize) {
+            for (usize chunk = begin; chunk < end && !failed.load(std::memory_order_relaxed); ++chunk) {
+                LineCursor cursor{text.data() + bounds[chunk], text.data() + bounds[chunk + 1]};
+
+                // A rough guess of 16 bytes per edge line avoids most reallocations
+                chunkEdges[chunk].reserve((bounds[chunk + 1] - bounds[chunk]) / 16);
+
+                if(!parse(chunk, cursor, chunkEdges[chunk])) {
+                    failed.store(true, std::memory_order_relaxed);
+                }
+            }
+        }, 1);
+
+        if(failed.load()) {
+            return std::nullopt;
+        }
+
+        return ParallelConcatenate(chunkEdges, threads);
+    }
+
+    // Bounds of the text that comes after the header (which must end at 'headerEnd')
+    static std::vector<usize> BodyChunks(std::string_view text, usize headerEnd, usize threads) {
+        std::vector<usize> bounds = LineChunks(text.substr(headerEnd), threads);
+
+        for (usize& bound : bounds) {
+            bound += headerEnd;
+        }
+
+        return bounds;
+    }
+
+    static Graph Build(usize vertices, std::vector<Edge>&& edges, bool directed) {
+        Graph graph(vertices, std::move(edges));
+        graph.SetDirected(directed);
+        return graph;
+    }
+
+    std::optional<Graph> ParseEdgeList(std::string_view text, bool directed, usize threads) {
+        std::vector<usize> bounds = LineChunks(text, threads);
+        std::vector<usize> maximums(bounds.size() - 1);
+        std::vector<u8> nonEmpty(bounds.size() - 1);
+
+        std::optional<std::vector<Edge>> edges = ParseChunks(text, bounds, threads, [&maximums, &nonEmpty](usize chunk, LineCursor& cursor, std::vector<Edge>& edges) {
+            usize maximum = 0;
+
+            for (; !cursor.Done(); cursor.NextLine()) {
+                char first = cursor.Peek();
+                if(first == '\n' || first == '#' || first == '%') {
+                    continue;
+                }
+
+                usize from, to;
+                if(!cursor.Read(from) || !cursor.Read(to)) {
+                    return false;
+                }
+
+                // Anything after the weight (e.g. timestamps) is ignored
+                f32 weight = 0;
+                if(!cursor.LineEnded() && !cursor.Read(weight)) {
+                    return false;
+                }
+
+                maximum = std::max({maximum, from, to});
+                edges.push_back(Edge{from, to, weight});
+            }
+
+            maximums[chunk] = maximum;
+            nonEmpty[chunk] = !edges.empty();
+            return true;
+        });
+
+        if(!edges) {
+            return std::nullopt;
+        }
+
+        usize vertices = 0;
+        for (usize chunk = 0; chunk < maximums.size(); ++chunk) {
+            if(nonEmpty[chunk]) {
+                vertices = std::max(vertices, maximums[chunk] + 1);
+            }
+        }
+
+        return Build(vertices, std::move(*edges), directed);
+    }
+
+    std::optional<Graph> ParseDIMACS(std::string_view text, usize threads) {
+        LineCursor header{text.data(), text.data() + text.size()};
+
+        // Everything before the problem line can only be comments
+        usize vertices = 0, edgesCount = 0;
+        bool directed = true;
+        for (;; header.NextLine()) {
+            if(header.Done()) {
+                return std::nullopt;
+            }
+
+            char first = header.Peek();
+            if(first == '\n' || first == 'c') {
+                continue;
+            }
+
+            if(header.Token() != "p") {
+                return std::nullopt;
+            }
+
+            std::string_view problem = header.Token();
+            if(!header.Read(vertices) || !header.Read(edgesCount)) {
+                return std::nullopt;
+            }
+
+            directed = problem != "edge" && problem != "col" && problem != "clq";
+            header.NextLine();
+            break;
+        }
+
+        std::vector<usize> bounds = BodyChunks(text, header.current - text.data(), threads);
+        std::optional<std::vector<Edge>> edges = ParseChunks(text, bounds, threads, [vertices](usize, LineCursor& cursor, std::vector<Edge>& edges) {
+            for (; !cursor.Done(); cursor.NextLine()) {
+                char first = cursor.Peek();
+                if(first == '\n' || first == 'c' || first == 'n') {
+                    continue;
+                }
+
+                if(first != 'a' && first != 'e') {
+                    return false;
+                }
+
+                ++cursor.current;
+
+                usize from, to;
+                if(!cursor.Read(from) || !cursor.Read(to) || from == 0 || to == 0 || from > vertices || to > vertices) {
+                    return false;
+                }
+
+                f32 weight = 0;
+                if(!cursor.LineEnded() && !cursor.Read(weight)) {
+                    return false;
+                }
+
+                edges.push_back(Edge{from - 1, to - 1, weight});
+            }
+
+            return true;
+        });
+
+        if(!edges) {
+            return std::nullopt;
+        }
+
+        return Build(vertices, std::move(*edges), directed);
+    }
+
+    std::optional<Graph> ParseMETIS(std::string_view text, usize threads) {
+        LineCursor header{text.data(), text.data() + text.size()};
+
+        usize vertices = 0, edgesCount = 0, format = 0, constraints = 0;
+        for (;; header.NextLine()) {
+            if(header.Done()) {
+                return std::nullopt;
+            }
+
+            char first = header.Peek();
+            if(first == '\n' || first == '%') {
+                continue;
+            }
+
+            if(!header.Read(vertices) || !header.Read(edgesCount)) {
+                return std::nullopt;
+            }
+
+            if(!header.LineEnded() && !header.Read(format)) {
+                return std::nullopt;
+            }
+
+            if(!header.LineEnded() && !header.Read(constraints)) {
+                return std::nullopt;
+            }
+
+            header.NextLine();
+            break;
+        }
+
+        // fmt is 3 decimal digits: vertex sizes, vertex weights, edge weights
+        bool edgeWeights = format % 10;
+        usize vertexValues = ((format / 10) % 10 ? std::max<usize>(constraints, 1) : 0) + ((format / 100) % 10 ? 1 : 0);
+
+        std::vector<usize> bounds = BodyChunks(text, header.current - text.data(), threads);
+        usize chunks = bounds.size() - 1;
+
+        // The line number is the vertex id, so every chunk first needs to know how many vertex lines come before it
+        auto isVertexLine = [](const char* line, const char* end) { return line == end || *line != '%'; };
+
+        std::vector<usize> firstVertex(chunks + 1);
+        ParallelFor(0, chunks, threads, [&](usize begin, usize end, usize) {
+            for (usize chunk = begin; chunk < end; ++chunk) {
+                const char* line = text.data() + bounds[chunk];
+                const char* chunkEnd = text.data() + bounds[chunk + 1];
+                usize count = 0;
+
+                while(line < chunkEnd) {
+                    const char* newline = static_cast<const char*>(std::memchr(line, '\n', chunkEnd - line));
+                    const char* lineEnd = newline ? newline : chunkEnd;
+
+                    count += isVertexLine(line, lineEnd);
+                    line = newline ? newline + 1 : chunkEnd;
+                }
+
+                firstVertex[chunk + 1] = count;
+            }
+        }, 1);
+
+        for (usize chunk = 0; chunk < chunks; ++chunk) {
+            firstVertex[chunk + 1] += firstVertex[chunk];
+        }
+
+        std::optional<std::vector<Edge>> edges = ParseChunks(text, bounds, threads, [&](usize chunk, LineCursor& cursor, std::vector<Edge>& edges) {
+            usize v = firstVertex[chunk];
+
+            for (; !cursor.Done(); cursor.NextLine()) {
+                if(!isVertexLine(cursor.current, cursor.end)) {
+                    continue;
+                }
+
+                usize vertex = v++;
+                if(vertex >= vertices) { // Only blank lines can follow the last vertex
+                    if(!cursor.LineEnded()) {
+                        return false;
+                    }
+
+                    continue;
+                }
+
+                for (usize i = 0; i < vertexValues; ++i) {
+                    i64 value;
+                    if(!cursor.Read(value)) {
+                        return false;
+                    }
+                }
+
+                while(!cursor.LineEnded()) {
+                    usize adjacent;
+                    if(!cursor.Read(adjacent) || adjacent == 0 || adjacent > vertices) {
+                        return false;
+                    }
+
+                    f32 weight = 0;
+                    if(edgeWeights && !cursor.Read(weight)) {
+                        return false;
+                    }
+
+                    // Listed by both endpoints, keep the one from the lower id
+                    if(vertex <= adjacent - 1) {
+                        edges.push_back(Edge{vertex, adjacent - 1, weight});
+                    }
+                }
+            }
+
+            return true;
+        });
+
+        if(!edges) {
+            return std::nullopt;
+        }
+
+        return Build(vertices, std::move(*edges), false);
+    }
+
+    static bool EqualsIgnoreCase(std::string_view a, std::string_view b) {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](char x, char y) {
+            return (x >= 'A' && x <= 'Z' ? x - 'A' + 'a' : x) == (y >= 'A' && y <= 'Z' ? y - 'A' + 'a' : y);
+        });
+    }
+
+    std::optional<Graph> ParseMatrixMarket(std::string_view text, usize threads) {
+        LineCursor header{text.data(), text.data() + text.size()};
+
+        // %%MatrixMarket matrix coordinate <field> <symmetry>
+        if(!EqualsIgnoreCase(header.Token(), "%%MatrixMarket") || !EqualsIgnoreCase(header.Token(), "matrix") || !EqualsIgnoreCase(header.Token(), "coordinate")) {
+            return std::nullopt;
+        }
+
+        std::string_view field = header.Token();
+        std::string_view symmetry = header.Token();
+
+        bool pattern = EqualsIgnoreCase(field, "pattern");
+        bool complex = EqualsIgnoreCase(field, "complex");
+        if(!pattern && !complex && !EqualsIgnoreCase(field, "real") && !EqualsIgnoreCase(field, "double") && !EqualsIgnoreCase(field, "integer")) {
+            return std::nullopt;
+        }
+
+        bool general = EqualsIgnoreCase(symmetry, "general");
+        if(!general && !EqualsIgnoreCase(symmetry, "symmetric") && !EqualsIgnoreCase(symmetry, "skew-symmetric") && !EqualsIgnoreCase(symmetry, "hermitian")) {
+            return std::nullopt;
+        }
+
+        usize rows = 0, columns = 0, entries = 0;
+        for (header.NextLine();; header.NextLine()) {
+            if(header.Done()) {
+                return std::nullopt;
+            }
+
+            char first = header.Peek();
+            if(first == '\n' || first == '%') {
+                continue;
+            }
+
+            if(!header.Read(rows) || !header.Read(columns) || !header.Read(entries)) {
+                return std::nullopt;
+            }
+
+            header.NextLine();
+            break;
+        }
+
+        std::vector<usize> bounds = BodyChunks(text, header.current - text.data(), threads);
+        std::optional<std::vector<Edge>> edges = ParseChunks(text, bounds, threads, [=](usize, LineCursor& cursor, std::vector<Edge>& edges) {
+            for (; !cursor.Done(); cursor.NextLine()) {
+                char first = cursor.Peek();
+                if(first == '\n' || first == '%') {
+                    continue;
+                }
+
+                usize row, column;
+                if(!cursor.Read(row) || !cursor.Read(column) || row == 0 || column == 0 || row > rows || column > columns) {
+                    return false;
+                }
+
+                // The imaginary part of complex values is dropped
+                f64 value = 0;
+                if(!pattern && !cursor.Read(value)) {
+                    return false;
+                }
+
+                edges.push_back(Edge{row - 1, column - 1, static_cast<f32>(value)});
+            }
+
+            return true;
+        });
+
+        if(!edges || edges->size() != entries) {
+            return std::nullopt;
+        }
+
+        return Build(std::max(rows, columns), std::move(*edges), general);
+    }
+
+    template<typename Parse>
+    static std::optional<Graph> LoadMapped(const std::filesystem::path& path, Parse&& parse) {
+        std::optional<MappedFile> file = MappedFile::Open(path);
+        if(!file) {
+            return std::nullopt;
+        }
+
+        file->AdviseSequential();
+        return parse(std::string_view(reinterpret_cast<const char*>(file->Data()), file->Size()));
+    }
+
+    std::optional<Graph> LoadEdgeList(const std::filesystem::path& path, bool directed, usize threads) {
+        return LoadMapped(path, [directed, threads](std::string_view text) { return ParseEdgeList(text, directed, threads); });
+    }
+
+    std::optional<Graph> LoadDIMACS(const std::filesystem::path& path, usize threads) {
+        return LoadMapped(path, [threads](std::string_view text) { return ParseDIMACS(text, threads); });
+    }
+
+    std::optional<Graph> LoadMETIS(const std::filesystem::path& path, usize threads) {
+        return LoadMapped(path, [threads](std::string_view text) { return ParseMETIS(text, threads); });
+    }
+
+    std::optional<Graph> LoadMatrixMarket(const std::filesystem::path& path, usize threads) {
+        return LoadMapped(path, [threads](std::string_view text) { return ParseMatrixMarket(text, threads); });
+    }
+} // namespace gpx
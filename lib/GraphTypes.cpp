@@ -1,20 +1,351 @@
 #include <Graphexia/GraphTypes.hpp>
+#include <Graphexia/ImplicitGraph.hpp>
+#include <Graphexia/Parallel.hpp>
+#include <Graphexia/Random.hpp>
+
+#include <algorithm>
 #include <cmath>
+#include <unordered_set>
 
 namespace gpx {
-    Graph CreateKComplete(usize k) {
-        Graph kCompleteGraph(k);
+    // Structured graphs know every edge id and every adjacency list by index arithmetic, so both arrays are sized once and
+    // filled in parallel from their implicit version
+    template<typename Implicit>
+    static Graph Materialize(const Implicit& implicit, usize threads) {
+        usize verticesCount = implicit.Vertices();
+        usize edgesCount = implicit.EdgeCount();
+
+        std::vector<Edge> edges(edgesCount);
+        std::vector<std::vector<usize>> edgesForVertex(verticesCount);
+
+        ParallelFor(0, edgesCount, threads, [&](usize begin, usize end, usize) {
+            for (usize id = begin; id < end; ++id) {
+                edges[id] = implicit.EdgeAt(id);
+            }
+        }, 1 << 16);
+
+        ParallelFor(0, verticesCount, threads, [&](usize begin, usize end, usize) {
+            for (usize v = begin; v < end; ++v) {
+                std::vector<usize>& adjacency = edgesForVertex[v];
+
+                adjacency.reserve(implicit.Degree(v));
+                implicit.ForEachAdjacent(v, [&adjacency](usize, usize edgeId) { adjacency.push_back(edgeId); });
+            }
+        }, 1 << 10);
+
+        return Graph(verticesCount, std::move(edges), std::move(edgesForVertex));
+    }
+
+    Graph CreateKComplete(usize k, usize threads) {
+        return Materialize(ImplicitCompleteGraph{k}, threads);
+    }
+
+    Graph CreateCompleteBipartite(usize left, usize right, usize threads) {
+        return Materialize(ImplicitCompleteBipartiteGraph{left, right}, threads);
+    }
+
+    Graph CreateHypercube(usize dimensions, usize threads) {
+        return Materialize(ImplicitHypercubeGraph{dimensions}, threads);
+    }
+
+    Graph CreateGrid(usize width, usize height, usize threads) {
+        return Materialize(ImplicitGridGraph{width, height, false}, threads);
+    }
+
+    Graph CreateTorus(usize width, usize height, usize threads) {
+        return Materialize(ImplicitGridGraph{width, height, true}, threads);
+    }
+
+    // Every (ordered if directed) pair of distinct vertices, G(n, 1)
+    static Graph CreateAllPairs(usize n, bool directed) {
+        std::vector<Edge> edges;
+        edges.reserve(directed ? n * (n - (n != 0)) : n * (n - (n != 0)) / 2);
+
+        for (usize v = 0; v < n; ++v) {
+            for (usize w = directed ? 0 : v + 1; w < n; ++w) {
+                if(w != v) {
+                    edges.push_back(Edge{v, w, 0});
+                }
+            }
+        }
+
+        Graph graph(n, std::move(edges));
+        graph.SetDirected(directed);
+        return graph;
+    }
+
+    // Pairs handled by one G(n, p) block. Fixed so the blocks (and therefore the output) don't depend on the thread count
+    static constexpr u64 GnpBlockPairs = u64(1) << 20;
+
+    Graph CreateGnp(usize n, f64 p, u64 seed, bool directed, usize threads) {
+        if(p >= 1) {
+            return CreateAllPairs(n, directed);
+        }
+
+        std::vector<Edge> edges;
+
+        if(p > 0 && n > 1) {
+            // Undirected pairs are (v, w) with w < v, directed ones every (v, w) with the loops thrown away
+            usize rowStart = directed ? 0 : 1;
+            auto rowLength = [n, directed](usize v) -> u64 { return directed ? n : v; };
+
+            // Whole rows per block, ~GnpBlockPairs pairs each
+            std::vector<usize> blockRows{rowStart};
+            u64 pairsInBlock = 0;
+            for (usize v = rowStart; v < n; ++v) {
+                pairsInBlock += rowLength(v);
+
+                if(pairsInBlock >= GnpBlockPairs) {
+                    blockRows.push_back(v + 1);
+                    pairsInBlock = 0;
+                }
+            }
+
+            if(blockRows.back() != n) {
+                blockRows.push_back(n);
+            }
+
+            usize blocks = blockRows.size() - 1;
+            f64 logComplement = std::log1p(-p);
+            std::vector<std::vector<Edge>> blockEdges(blocks);
+
+            ParallelFor(0, blocks, threads, [&](usize begin, usize end, usize) {
+                for (usize block = begin; block < end; ++block) {
+                    usize v = blockRows[block], lastRow = blockRows[block + 1];
+
+                    f64 pairs = 0;
+                    for (usize row = v; row < lastRow; ++row) {
+                        pairs += f64(rowLength(row));
+                    }
+
+                    // Batagelj & Brandes: the gap between two consecutive edges in the pair sequence is geometric,
+                    // so only the m edges are drawn instead of every pair.
+                    CounterRandom generator(seed, block);
+                    std::vector<Edge>& generated = blockEdges[block];
+                    generated.reserve(usize(pairs * p * 1.05) + 16);
+
+                    u64 w = 0;
+                    bool first = true;
+
+                    while(v < lastRow) {
+                        f64 skip = std::floor(std::log(1.0 - generator.NextUnit()) / logComplement);
+                        u64 step = skip >= pairs ? u64(pairs) + 1 : u64(skip) + !first;
+                        first = false;
+
+                        w += step;
+                        while(v < lastRow && w >= rowLength(v)) {
+                            w -= rowLength(v);
+                            ++v;
+                        }
+
+                        if(v < lastRow && (!directed || v != w)) {
+                            generated.push_back(Edge{v, usize(w), 0});
+                        }
+                    }
+                }
+            }, 1);
+
+            edges = ParallelConcatenate(blockEdges, threads);
+        }
+
+        Graph graph(n, std::move(edges));
+        graph.SetDirected(directed);
+        return graph;
+    }
+
+    // Pair index -> (v, w), the inverse of the pair order used by CreateGnp
+    static Edge PairFromIndex(u64 index, usize n, bool directed) {
+        if(directed) {
+            usize v = index / (n - 1);
+            usize w = index % (n - 1);
+            return Edge{v, w >= v ? w + 1 : w, 0};
+        }
+
+        // index = v * (v - 1) / 2 + w, the sqrt estimate can be off by one either way
+        u64 v = u64((1.0 + std::sqrt(1.0 + 8.0 * f64(index))) / 2.0);
+        while(v * (v - 1) / 2 > index) {
+            --v;
+        }
+        while((v + 1) * v / 2 <= index) {
+            ++v;
+        }
 
-        for (usize i = 0; i < k; ++i) {
-            usize fromId = i;
+        return Edge{usize(v), usize(index - v * (v - 1) / 2), 0};
+    }
+
+    Graph CreateGnm(usize n, usize m, u64 seed, bool directed) {
+        u64 pairs = n < 2 ? 0 : (directed ? u64(n) * (n - 1) : u64(n) * (n - 1) / 2);
+        m = std::min<u64>(m, pairs);
+
+        // Dense requests pick the pairs that are NOT edges instead, so the sample is never more than half of all pairs
+        bool complement = m > pairs / 2;
+        u64 samples = complement ? pairs - m : m;
+
+        // Floyd's sampling, exactly 'samples' random draws without any retry
+        CounterRandom generator(seed);
+        std::unordered_set<u64> chosen;
+        chosen.reserve(samples);
+
+        for (u64 j = pairs - samples; j < pairs; ++j) {
+            u64 t = generator.NextBelow(j + 1);
+
+            if(!chosen.insert(t).second) {
+                chosen.insert(j);
+            }
+        }
+
+        std::vector<u64> indices(chosen.begin(), chosen.end());
+        std::sort(indices.begin(), indices.end());
+        chosen = std::unordered_set<u64>();
+
+        std::vector<Edge> edges;
+        edges.reserve(m);
+
+        if(complement) {
+            usize next = 0;
+
+            for (u64 index = 0; index < pairs; ++index) {
+                if(next < indices.size() && indices[next] == index) {
+                    ++next;
+                    continue;
+                }
+
+                edges.push_back(PairFromIndex(index, n, directed));
+            }
+        } else {
+            for (const u64 index : indices) {
+                edges.push_back(PairFromIndex(index, n, directed));
+            }
+        }
+
+        Graph graph(n, std::move(edges));
+        graph.SetDirected(directed);
+        return graph;
+    }
+
+    Graph CreateBarabasiAlbert(usize n, usize m, u64 seed) {
+        if(m == 0 || n < 2) {
+            return Graph(n);
+        }
+
+        m = std::min(m, n - 1);
+
+        std::vector<Edge> edges;
+        edges.reserve(m * (n - m));
+
+        // Every edge endpoint once, picking uniformly from here is picking proportionally to the degree
+        std::vector<usize> endpoints;
+        endpoints.reserve(2 * m * (n - m));
+
+        // Start with a star so the first vertices already have some degree
+        for (usize i = 1; i <= m; ++i) {
+            edges.push_back(Edge{0, i, 0});
+            endpoints.push_back(0);
+            endpoints.push_back(i);
+        }
+
+        CounterRandom generator(seed);
+        std::vector<usize> pickedBy(n, n);
+        std::vector<usize> targets(m);
 
-            for (usize j = i + 1; j < k; ++j) {
-                usize toId = j;
+        for (usize source = m + 1; source < n; ++source) {
+            // There are always at least m + 1 distinct vertices to pick from
+            for (usize i = 0; i < m; ++i) {
+                usize target;
 
-                kCompleteGraph.AddEdge(fromId, toId);
+                do {
+                    target = endpoints[generator.NextBelow(endpoints.size())];
+                } while(pickedBy[target] == source);
+
+                pickedBy[target] = source;
+                targets[i] = target;
+            }
+
+            for (const usize target : targets) {
+                edges.push_back(Edge{source, target, 0});
+                endpoints.push_back(source);
+                endpoints.push_back(target);
+            }
+        }
+
+        return Graph(n, std::move(edges));
+    }
+
+    Graph CreateWattsStrogatz(usize n, usize k, f64 beta, u64 seed) {
+        usize half = n < 2 ? 0 : std::min(k / 2, (n - 1) / 2);
+
+        auto key = [n](usize a, usize b) { return u64(std::min(a, b)) * n + std::max(a, b); };
+
+        std::vector<Edge> edges;
+        std::unordered_set<u64> present;
+        std::vector<usize> degrees(n, 2 * half);
+        edges.reserve(half * n);
+        present.reserve(half * n);
+
+        for (usize j = 1; j <= half; ++j) {
+            for (usize u = 0; u < n; ++u) {
+                usize v = (u + j) % n;
+
+                edges.push_back(Edge{u, v, 0});
+                present.insert(key(u, v));
+            }
+        }
+
+        if(beta > 0) {
+            CounterRandom generator(seed);
+
+            // Same order as the lattice construction: nearest neighbours first, then the next ring...
+            for (Edge& edge : edges) {
+                if(generator.NextUnit() >= beta || degrees[edge.fromId] >= n - 1) {
+                    continue;
+                }
+
+                usize w;
+                do {
+                    w = generator.NextBelow(n);
+                } while(w == edge.fromId || present.contains(key(edge.fromId, w)));
+
+                present.erase(key(edge.fromId, edge.toId));
+                present.insert(key(edge.fromId, w));
+                --degrees[edge.toId];
+                ++degrees[w];
+                edge.toId = w;
             }
         }
 
-        return kCompleteGraph;
+        return Graph(n, std::move(edges));
+    }
+
+    Graph CreateRMAT(usize scale, usize edges, f64 a, f64 b, f64 c, u64 seed, usize threads) {
+        usize n = usize(1) << scale;
+
+        // Every edge has its own stream, so any split of the edges between threads generates the same graph
+        std::vector<Edge> generated(edges);
+        ParallelFor(0, edges, threads, [&](usize begin, usize end, usize) {
+            for (usize e = begin; e < end; ++e) {
+                CounterRandom generator(seed, e);
+                usize from = 0, to = 0;
+
+                // Descend one quadrant of the adjacency matrix per bit
+                for (usize bit = n >> 1; bit != 0; bit >>= 1) {
+                    f64 r = generator.NextUnit();
+
+                    if(r >= a + b + c) {
+                        from |= bit;
+                        to |= bit;
+                    } else if(r >= a + b) {
+                        from |= bit;
+                    } else if(r >= a) {
+                        to |= bit;
+                    }
+                }
+
+                generated[e] = Edge{from, to, 0};
+            }
+        });
+
+        Graph graph(n, std::move(generated));
+        graph.SetDirected(true);
+        return graph;
     }
 } // namespace gpx
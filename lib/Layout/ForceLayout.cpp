@@ -0,0 +1,446 @@
+#include <Graphexia/Layout/ForceLayout.hpp>
+#include <Graphexia/Parallel.hpp>
+#include <Graphexia/Random.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace gpx {
+    // Cells with at most this many points aren't split further
+    static constexpr u32 LeafSize = 16;
+    // 16 bits per axis in the Morton codes
+    static constexpr u32 MaxDepth = 16;
+    // Keeps 1 / d^2 finite for (almost) coincident vertices, which otherwise push each other by nothing
+    static constexpr f32 Softening = 1e-4f;
+
+    // Per chunk reductions, padded to avoid false sharing between threads
+    struct alignas(64) LayoutReduction {
+        f64 swing;
+        f64 traction;
+        f64 displacement;
+    };
+
+    static u32 SpreadBits(u32 value) {
+        value &= 0xFFFF;
+        value = (value | (value << 8)) & 0x00FF00FF;
+        value = (value | (value << 4)) & 0x0F0F0F0F;
+        value = (value | (value << 2)) & 0x33333333;
+        value = (value | (value << 1)) & 0x55555555;
+        return value;
+    }
+
+    // LSD radix sort of (code << 32 | vertex) keys by their code, 8 bits per pass
+    static void SortKeys(std::vector<u64>& keys, std::vector<u64>& scratch) {
+        scratch.resize(keys.size());
+
+        for (u32 shift = 32; shift < 64; shift += 8) {
+            usize counts[257] = {};
+            for (const u64 key : keys) {
+                ++counts[((key >> shift) & 0xFF) + 1];
+            }
+
+            for (usize i = 0; i < 256; ++i) {
+                counts[i + 1] += counts[i];
+            }
+
+            for (const u64 key : keys) {
+                scratch[counts[(key >> shift) & 0xFF]++] = key;
+            }
+
+            keys.swap(scratch);
+        }
+    }
+
+    // Fills cells[slot] with the points [begin, end), splitting them by the 2 Morton bits of 'level'. Children go at the end of cells.
+    static void BuildCell(ForceLayoutState& state, u32 slot, u32 begin, u32 end, u32 level, f32 size) {
+        if(end - begin <= LeafSize || level == MaxDepth) {
+            f32 mass = 0, x = 0, y = 0;
+
+            for (u32 i = begin; i < end; ++i) {
+                mass += state.sortedMasses[i];
+                x += state.sortedX[i] * state.sortedMasses[i];
+                y += state.sortedY[i] * state.sortedMasses[i];
+            }
+
+            state.cells[slot] = ForceLayoutCell{x / mass, y / mass, mass, size, begin, end, 0, 0};
+            return;
+        }
+
+        // Points of the cell share the code bits above 'level', so the quadrant is nondecreasing over the range
+        u32 shift = 32 + 2 * (MaxDepth - 1 - level);
+        u32 splits[5] = {begin, 0, 0, 0, end};
+
+        for (u32 quadrant = 1; quadrant < 4; ++quadrant) {
+            splits[quadrant] = static_cast<u32>(std::partition_point(state.keys.begin() + splits[quadrant - 1], state.keys.begin() + end, [shift, quadrant](u64 key) {
+                return ((key >> shift) & 3) < quadrant;
+            }) - state.keys.begin());
+        }
+
+        u32 childCount = 0;
+        for (u32 quadrant = 0; quadrant < 4; ++quadrant) {
+            childCount += splits[quadrant] != splits[quadrant + 1];
+        }
+
+        u32 children = static_cast<u32>(state.cells.size());
+        state.cells.resize(state.cells.size() + childCount);
+
+        u32 child = children;
+        for (u32 quadrant = 0; quadrant < 4; ++quadrant) {
+            if(splits[quadrant] != splits[quadrant + 1]) {
+                BuildCell(state, child++, splits[quadrant], splits[quadrant + 1], level + 1, size * .5f);
+            }
+        }
+
+        f32 mass = 0, x = 0, y = 0;
+        for (u32 i = children; i < children + childCount; ++i) {
+            const ForceLayoutCell& cell = state.cells[i];
+
+            mass += cell.mass;
+            x += cell.x * cell.mass;
+            y += cell.y * cell.mass;
+        }
+
+        state.cells[slot] = ForceLayoutCell{x / mass, y / mass, mass, size, begin, end, children, childCount};
+    }
+
+    static void BuildTree(ForceLayoutState& state) {
+        usize verticesCount = state.x.size();
+
+        f32 minX = std::numeric_limits<f32>::max(), minY = minX;
+        f32 maxX = std::numeric_limits<f32>::lowest(), maxY = maxX;
+        for (usize v = 0; v < verticesCount; ++v) {
+            minX = std::min(minX, state.x[v]);
+            maxX = std::max(maxX, state.x[v]);
+            minY = std::min(minY, state.y[v]);
+            maxY = std::max(maxY, state.y[v]);
+        }
+
+        f32 size = std::max({maxX - minX, maxY - minY, 1e-6f});
+        f32 scale = 65535.f / size;
+
+        state.keys.resize(verticesCount);
+        ParallelFor(0, verticesCount, state.options.threads, [&](usize begin, usize end, usize) {
+            for (usize v = begin; v < end; ++v) {
+                u32 cellX = static_cast<u32>((state.x[v] - minX) * scale);
+                u32 cellY = static_cast<u32>((state.y[v] - minY) * scale);
+                u64 code = SpreadBits(cellX) | (SpreadBits(cellY) << 1);
+
+                state.keys[v] = (code << 32) | v;
+            }
+        });
+
+        std::vector<u64> scratch;
+        SortKeys(state.keys, scratch);
+
+        state.order.resize(verticesCount);
+        state.sortedX.resize(verticesCount);
+        state.sortedY.resize(verticesCount);
+        state.sortedMasses.resize(verticesCount);
+
+        ParallelFor(0, verticesCount, state.options.threads, [&](usize begin, usize end, usize) {
+            for (usize i = begin; i < end; ++i) {
+                u32 v = static_cast<u32>(state.keys[i]);
+
+                state.order[i] = v;
+                state.sortedX[i] = state.x[v];
+                state.sortedY[i] = state.y[v];
+                state.sortedMasses[i] = state.masses[v];
+            }
+        });
+
+        state.cells.clear();
+        state.cells.resize(1);
+        BuildCell(state, 0, 0, static_cast<u32>(verticesCount), 0, size);
+    }
+
+    // Sum of mass[i] * (p - point[i]) / |p - point[i]|^2 over the interaction list. Accumulated in 8 independent lanes so the
+    // loop is a straight run of SIMD multiplies / divides over the SoA arrays.
+    static void Repulse(const f32* pointsX, const f32* pointsY, const f32* masses, usize count, f32 x, f32 y, f32& forceX, f32& forceY) {
+        constexpr usize Lanes = 8;
+        f32 lanesX[Lanes] = {}, lanesY[Lanes] = {};
+
+        usize i = 0;
+        for (; i + Lanes <= count; i += Lanes) {
+            for (usize k = 0; k < Lanes; ++k) {
+                f32 dx = x - pointsX[i + k];
+                f32 dy = y - pointsY[i + k];
+                f32 factor = masses[i + k] / (dx * dx + dy * dy + Softening);
+
+                lanesX[k] += factor * dx;
+                lanesY[k] += factor * dy;
+            }
+        }
+
+        for (; i < count; ++i) {
+            f32 dx = x - pointsX[i];
+            f32 dy = y - pointsY[i];
+            f32 factor = masses[i] / (dx * dx + dy * dy + Softening);
+
+            lanesX[0] += factor * dx;
+            lanesY[0] += factor * dy;
+        }
+
+        for (usize k = 0; k < Lanes; ++k) {
+            forceX += lanesX[k];
+            forceY += lanesY[k];
+        }
+    }
+
+    // Repulsion through the tree, vertices are visited in Morton order so neighbouring ones walk the same cells
+    static void ComputeRepulsion(ForceLayoutState& state) {
+        const f32 theta2 = state.options.theta * state.options.theta;
+        const bool atlas = state.options.model == ForceModel::ForceAtlas2;
+        const f32 strength = atlas ? state.options.scaling : state.options.scaling * state.options.scaling;
+
+        ParallelFor(0, state.order.size(), state.options.threads, [&](usize begin, usize end, usize) {
+            std::vector<f32> pointsX, pointsY, masses;
+            std::vector<u32> stack;
+
+            auto add = [&](f32 x, f32 y, f32 mass) {
+                pointsX.push_back(x);
+                pointsY.push_back(y);
+                masses.push_back(mass);
+            };
+
+            for (usize i = begin; i < end; ++i) {
+                f32 x = state.sortedX[i], y = state.sortedY[i];
+
+                pointsX.clear();
+                pointsY.clear();
+                masses.clear();
+                stack.assign(1, 0);
+
+                while(!stack.empty()) {
+                    const ForceLayoutCell& cell = state.cells[stack.back()];
+                    stack.pop_back();
+
+                    f32 dx = x - cell.x, dy = y - cell.y;
+                    if(cell.size * cell.size < theta2 * (dx * dx + dy * dy)) {
+                        add(cell.x, cell.y, cell.mass);
+                        continue;
+                    }
+
+                    if(cell.childCount == 0) {
+                        pointsX.insert(pointsX.end(), state.sortedX.begin() + cell.begin, state.sortedX.begin() + cell.end);
+                        pointsY.insert(pointsY.end(), state.sortedY.begin() + cell.begin, state.sortedY.begin() + cell.end);
+                        masses.insert(masses.end(), state.sortedMasses.begin() + cell.begin, state.sortedMasses.begin() + cell.end);
+                        continue;
+                    }
+
+                    for (u32 child = cell.children; child < cell.children + cell.childCount; ++child) {
+                        stack.push_back(child);
+                    }
+                }
+
+                // The vertex itself is in the list, at distance 0 it adds nothing
+                f32 forceX = 0, forceY = 0;
+                Repulse(pointsX.data(), pointsY.data(), masses.data(), pointsX.size(), x, y, forceX, forceY);
+
+                u32 v = state.order[i];
+                f32 factor = strength * (atlas ? state.sortedMasses[i] : 1.f);
+                state.forceX[v] = forceX * factor;
+                state.forceY[v] = forceY * factor;
+            }
+        });
+    }
+
+    ForceLayoutState SetupForceLayout(GraphCSR&& csr, std::vector<f32>&& weights, std::span<const f32> vertexWeights, const ForceLayoutOptions& options, std::span<const f32> positions) {
+        usize verticesCount = csr.Vertices();
+        bool atlas = options.model == ForceModel::ForceAtlas2;
+
+        if(weights.size() != csr.Entries()) {
+            weights.clear();
+        }
+
+        if(vertexWeights.size() != verticesCount) {
+            vertexWeights = {};
+        }
+
+        std::vector<f32> masses(verticesCount, 1.f);
+        for (usize v = 0; v < verticesCount; ++v) {
+            f32 mass = vertexWeights.empty() ? 1.f : vertexWeights[v];
+
+            if(atlas) {
+                if(weights.empty()) {
+                    mass += static_cast<f32>(csr.Degree(v));
+                } else {
+                    for (usize i = csr.offsets[v]; i < csr.offsets[v + 1]; ++i) {
+                        mass += weights[i];
+                    }
+                }
+            }
+
+            masses[v] = mass;
+        }
+
+        std::vector<f32> x(verticesCount), y(verticesCount);
+        if(positions.size() == 2 * verticesCount) {
+            for (usize v = 0; v < verticesCount; ++v) {
+                x[v] = positions[2 * v];
+                y[v] = positions[2 * v + 1];
+            }
+        } else {
+            // Spread so the average distance between vertices is about one edge length
+            f32 side = options.scaling * std::sqrt(static_cast<f32>(verticesCount));
+
+            for (usize v = 0; v < verticesCount; ++v) {
+                CounterRandom generator(options.seed, v);
+                x[v] = static_cast<f32>(generator.NextUnit() - .5) * side;
+                y[v] = static_cast<f32>(generator.NextUnit() - .5) * side;
+            }
+        }
+
+        std::vector<usize> bounds = BalancedBounds(csr, ResolveThreads(options.threads));
+
+        ForceLayoutState state{
+            options,
+            std::move(csr),
+            std::move(masses),
+            std::move(weights),
+            std::move(bounds),
+            std::move(x), std::move(y),
+            std::vector<f32>(verticesCount), std::vector<f32>(verticesCount),
+            std::vector<f32>(verticesCount), std::vector<f32>(verticesCount),
+            {}, {}, {}, {}, {}, {},
+            .1f * options.scaling * std::sqrt(static_cast<f32>(verticesCount)),
+            1.f,
+            0.f,
+            0
+        };
+
+        return state;
+    }
+
+    ForceLayoutState SetupForceLayout(GraphCSR&& csr, const ForceLayoutOptions& options, std::span<const f32> positions) {
+        return SetupForceLayout(std::move(csr), std::vector<f32>(), std::span<const f32>(), options, positions);
+    }
+
+    ForceLayoutState SetupForceLayout(const Graph& graph, const ForceLayoutOptions& options, std::span<const f32> positions) {
+        return SetupForceLayout(CreateCSR(graph, CSRDirection::Both), options, positions);
+    }
+
+    bool IterateForceLayout(ForceLayoutState& state) {
+        usize verticesCount = state.x.size();
+        if(verticesCount == 0 || state.iteration >= state.options.maxIterations) {
+            return true;
+        }
+
+        const bool atlas = state.options.model == ForceModel::ForceAtlas2;
+        const f32 scaling = state.options.scaling;
+        const f32 gravity = state.options.gravity;
+        const bool weighted = !state.weights.empty();
+
+        BuildTree(state);
+        ComputeRepulsion(state);
+
+        // Attraction along the edges and gravity, both only read positions so every vertex is independent
+        std::vector<LayoutReduction> reductions(state.bounds.size() - 1);
+        ParallelForChunks(state.bounds, [&](usize begin, usize end, usize chunk) {
+            LayoutReduction reduction{};
+
+            for (usize v = begin; v < end; ++v) {
+                f32 x = state.x[v], y = state.y[v];
+                f32 forceX = state.forceX[v], forceY = state.forceY[v];
+
+                for (usize i = state.csr.offsets[v]; i < state.csr.offsets[v + 1]; ++i) {
+                    usize u = state.csr.adjacent[i];
+                    f32 dx = state.x[u] - x, dy = state.y[u] - y;
+                    f32 factor = atlas ? 1.f : std::sqrt(dx * dx + dy * dy) / scaling;
+                    if(weighted) {
+                        factor *= state.weights[i];
+                    }
+
+                    forceX += dx * factor;
+                    forceY += dy * factor;
+                }
+
+                f32 distance = std::sqrt(x * x + y * y);
+                if(distance > 0) {
+                    forceX -= gravity * state.masses[v] * x / distance;
+                    forceY -= gravity * state.masses[v] * y / distance;
+                }
+
+                state.forceX[v] = forceX;
+                state.forceY[v] = forceY;
+
+                if(atlas) {
+                    f32 swingX = forceX - state.previousForceX[v], swingY = forceY - state.previousForceY[v];
+                    f32 tractionX = forceX + state.previousForceX[v], tractionY = forceY + state.previousForceY[v];
+
+                    reduction.swing += state.masses[v] * std::sqrt(swingX * swingX + swingY * swingY);
+                    reduction.traction += state.masses[v] * std::sqrt(tractionX * tractionX + tractionY * tractionY) * .5f;
+                }
+            }
+
+            reductions[chunk] = reduction;
+        });
+
+        if(atlas) {
+            f64 swing = 0, traction = 0;
+            for (const LayoutReduction& reduction : reductions) {
+                swing += reduction.swing;
+                traction += reduction.traction;
+            }
+
+            // Global speed follows traction / swing, but never grows more than 50% in one step
+            f32 target = swing > 0 ? static_cast<f32>(traction / swing) : state.speed;
+            state.speed += std::min(target - state.speed, .5f * state.speed);
+        }
+
+        ParallelForChunks(state.bounds, [&](usize begin, usize end, usize chunk) {
+            f64 displacement = 0;
+
+            for (usize v = begin; v < end; ++v) {
+                f32 forceX = state.forceX[v], forceY = state.forceY[v];
+                f32 force = std::sqrt(forceX * forceX + forceY * forceY);
+                f32 factor;
+
+                if(atlas) {
+                    f32 swingX = forceX - state.previousForceX[v], swingY = forceY - state.previousForceY[v];
+                    f32 swing = state.masses[v] * std::sqrt(swingX * swingX + swingY * swingY);
+
+                    // Vertices that oscillate slow down, no vertex moves more than 10 units at once
+                    factor = state.speed / (1.f + std::sqrt(state.speed * swing));
+                    factor = force > 0 ? std::min(factor, 10.f / force) : 0.f;
+
+                    state.previousForceX[v] = forceX;
+                    state.previousForceY[v] = forceY;
+                } else {
+                    factor = force > 0 ? std::min(force, state.temperature) / force : 0.f;
+                }
+
+                state.x[v] += forceX * factor;
+                state.y[v] += forceY * factor;
+                displacement += force * factor;
+            }
+
+            reductions[chunk].displacement = displacement;
+        });
+
+        f64 displacement = 0;
+        for (const LayoutReduction& reduction : reductions) {
+            displacement += reduction.displacement;
+        }
+
+        ++state.iteration;
+        state.displacement = static_cast<f32>(displacement / verticesCount);
+        state.temperature = .1f * scaling * std::sqrt(static_cast<f32>(verticesCount)) * (1.f - static_cast<f32>(state.iteration) / state.options.maxIterations);
+
+        return state.iteration >= state.options.maxIterations || state.displacement < state.options.tolerance;
+    }
+
+    std::vector<f32> ForceLayout(const Graph& graph, const ForceLayoutOptions& options, std::span<const f32> positions) {
+        ForceLayoutState state = SetupForceLayout(graph, options, positions);
+        while(!IterateForceLayout(state)) {
+        }
+
+        std::vector<f32> result(2 * state.x.size());
+        for (usize v = 0; v < state.x.size(); ++v) {
+            result[2 * v] = state.x[v];
+            result[2 * v + 1] = state.y[v];
+        }
+
+        return result;
+    }
+} // namespace gpx
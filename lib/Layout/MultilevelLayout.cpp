@@ -0,0 +1,100 @@
+#include <Graphexia/Layout/MultilevelLayout.hpp>
+#include <Graphexia/Parallel.hpp>
+#include <Graphexia/Random.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace gpx {
+    MultilevelLayoutState SetupMultilevelLayout(CoarseningHierarchy&& hierarchy, const MultilevelLayoutOptions& options) {
+        MultilevelLayoutState state{options, std::move(hierarchy), 0, ForceLayoutState()};
+        if(state.hierarchy.Levels() == 0) {
+            return state;
+        }
+
+        state.level = state.hierarchy.Levels() - 1;
+        const CoarseningLevel& coarsest = state.hierarchy.Coarsest();
+        state.force = SetupForceLayout(GraphCSR(coarsest.csr), std::vector<f32>(coarsest.entryWeights), coarsest.vertexWeights, options.force);
+        return state;
+    }
+
+    MultilevelLayoutState SetupMultilevelLayout(const Graph& graph, const MultilevelLayoutOptions& options) {
+        return SetupMultilevelLayout(CreateCoarseningHierarchy(graph, options.coarsening), options);
+    }
+
+    bool IterateMultilevelLayout(MultilevelLayoutState& state) {
+        if(state.hierarchy.Levels() == 0) {
+            return true;
+        }
+
+        if(!IterateForceLayout(state.force)) {
+            return false;
+        }
+
+        if(state.level == 0) {
+            return true;
+        }
+
+        const CoarseningLevel& fine = state.hierarchy.Level(state.level - 1);
+        usize fineCount = fine.csr.Vertices();
+        usize coarseCount = state.force.x.size();
+
+        // Same density with more vertices means a proportionally larger area
+        f32 scale = std::sqrt(static_cast<f32>(fineCount) / static_cast<f32>(coarseCount));
+        f32 jitter = .5f * state.options.force.scaling;
+
+        std::vector<f32> finePositions(2 * fineCount);
+        ParallelFor(0, fineCount, state.options.force.threads, [&](usize begin, usize end, usize) {
+            for (usize v = begin; v < end; ++v) {
+                usize parent = fine.parents[v];
+                CounterRandom generator(state.options.force.seed ^ state.level, v);
+
+                finePositions[2 * v] = state.force.x[parent] * scale + static_cast<f32>(generator.NextUnit() - .5) * jitter;
+                finePositions[2 * v + 1] = state.force.y[parent] * scale + static_cast<f32>(generator.NextUnit() - .5) * jitter;
+            }
+        });
+
+        ForceLayoutOptions refine = state.options.force;
+        refine.maxIterations = state.options.refineIterations;
+
+        --state.level;
+        state.force = SetupForceLayout(GraphCSR(fine.csr), std::vector<f32>(fine.entryWeights), fine.vertexWeights, refine, finePositions);
+        return false;
+    }
+
+    void MultilevelLayoutPositions(const MultilevelLayoutState& state, std::span<f32> x, std::span<f32> y) {
+        usize count = std::min(x.size(), y.size());
+        if(state.hierarchy.Levels() != 0) {
+            count = std::min(count, state.hierarchy.Level(0).csr.Vertices());
+        }
+
+        ParallelFor(0, count, state.options.force.threads, [&](usize begin, usize end, usize) {
+            for (usize v = begin; v < end; ++v) {
+                usize ancestor = state.hierarchy.Ancestor(v, state.level);
+                x[v] = state.force.x[ancestor];
+                y[v] = state.force.y[ancestor];
+            }
+        });
+    }
+
+    static std::vector<f32> RunMultilevelLayout(MultilevelLayoutState&& state) {
+        while(!IterateMultilevelLayout(state)) {
+        }
+
+        std::vector<f32> positions(2 * state.force.x.size());
+        for (usize v = 0; v < state.force.x.size(); ++v) {
+            positions[2 * v] = state.force.x[v];
+            positions[2 * v + 1] = state.force.y[v];
+        }
+
+        return positions;
+    }
+
+    std::vector<f32> MultilevelLayout(const CoarseningHierarchy& hierarchy, const MultilevelLayoutOptions& options) {
+        return RunMultilevelLayout(SetupMultilevelLayout(CoarseningHierarchy(hierarchy), options));
+    }
+
+    std::vector<f32> MultilevelLayout(const Graph& graph, const MultilevelLayoutOptions& options) {
+        return RunMultilevelLayout(SetupMultilevelLayout(graph, options));
+    }
+} // namespace gpx
@@ -0,0 +1,395 @@
+#include <Graphexia/Layout/SpectralLayout.hpp>
+#include <Graphexia/Parallel.hpp>
+#include <Graphexia/Random.hpp>
+#include <Graphexia/SpMV.hpp>
+#include <Graphexia/SymmetricEigen.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace gpx {
+    // Per chunk partial sums are padded to a cache line to avoid false sharing between threads
+    static constexpr usize SpectralReductionStride = 8;
+
+    struct SpectralContext {
+        const GraphCSR& csr;
+        std::vector<usize> bounds;
+        // (d + tau)^-1/2, 0 for vertices without any weight
+        std::vector<f64> inverseSqrtDegrees;
+        // Unit D^1/2 1, the eigenvector of eigenvalue 1 every other one is orthogonal to
+        std::vector<f64> trivial;
+        // tau / n, weight of the edge joining every pair of vertices
+        f64 teleport;
+
+        std::vector<f64> scaled;
+        std::vector<f64> partials;
+    };
+
+    // y = (x + D^-1/2 (A + tau / n J) D^-1/2 x) / 2, the shift maps the spectrum to [0, 1] so the eigenvalues near -1 of
+    // (nearly) bipartite graphs don't compete with the ones we want
+    static void ApplySpectralOperator(SpectralContext& context, const std::vector<f64>& x, std::vector<f64>& y) {
+        usize chunks = context.bounds.size() - 1;
+
+        ParallelForChunks(context.bounds, [&](usize begin, usize end, usize chunk) {
+            f64 sum = 0;
+            for (usize v = begin; v < end; ++v) {
+                context.scaled[v] = context.inverseSqrtDegrees[v] * x[v];
+                sum += context.scaled[v];
+            }
+
+            context.partials[chunk * SpectralReductionStride] = sum;
+        });
+
+        f64 total = 0;
+        for (usize chunk = 0; chunk < chunks; ++chunk) {
+            total += context.partials[chunk * SpectralReductionStride];
+        }
+
+        const f64 uniform = context.teleport * total;
+        PullSpMV(context.csr, context.scaled.data(), context.bounds, [&](usize v, f64 sum, usize) {
+            y[v] = .5 * (x[v] + context.inverseSqrtDegrees[v] * (sum + uniform));
+        });
+    }
+
+    // Removes from w its components along the trivial eigenvector and basis[0, count) by classical Gram-Schmidt. A second pass
+    // only runs when the first one cancelled most of w, which is when rounding errors would make the basis lose orthogonality
+    // (Daniel, Gragg, Kaufman and Stewart). coefficients[i] receives the component along basis[i], coefficients[count] the one along the trivial eigenvector.
+    static void OrthogonalizeSpectral(SpectralContext& context, const std::vector<std::vector<f64>>& basis, usize count, std::vector<f64>& w, std::vector<f64>& coefficients) {
+        usize chunks = context.bounds.size() - 1;
+        // Components along the basis, the trivial eigenvector and the squared norm of w
+        usize stride = (count + 1 + SpectralReductionStride) / SpectralReductionStride * SpectralReductionStride;
+
+        context.partials.assign(chunks * stride, 0.);
+        std::fill(coefficients.begin(), coefficients.begin() + count + 1, 0.);
+
+        std::vector<f64> pass(count + 2);
+        for (usize repeat = 0; repeat < 2; ++repeat) {
+            ParallelForChunks(context.bounds, [&](usize begin, usize end, usize chunk) {
+                f64* partial = context.partials.data() + chunk * stride;
+
+                f64 sum = 0, squaredNorm = 0;
+                for (usize v = begin; v < end; ++v) {
+                    sum += context.trivial[v] * w[v];
+                    squaredNorm += w[v] * w[v];
+                }
+                partial[count] = sum;
+                partial[count + 1] = squaredNorm;
+
+                for (usize i = 0; i < count; ++i) {
+                    const f64* vector = basis[i].data();
+
+                    sum = 0;
+                    for (usize v = begin; v < end; ++v) {
+                        sum += vector[v] * w[v];
+                    }
+                    partial[i] = sum;
+                }
+            });
+
+            std::fill(pass.begin(), pass.end(), 0.);
+            for (usize chunk = 0; chunk < chunks; ++chunk) {
+                for (usize i = 0; i < count + 2; ++i) {
+                    pass[i] += context.partials[chunk * stride + i];
+                }
+            }
+
+            ParallelForChunks(context.bounds, [&](usize begin, usize end, usize) {
+                for (usize v = begin; v < end; ++v) {
+                    w[v] -= pass[count] * context.trivial[v];
+                }
+
+                for (usize i = 0; i < count; ++i) {
+                    const f64* vector = basis[i].data();
+                    const f64 coefficient = pass[i];
+
+                    for (usize v = begin; v < end; ++v) {
+                        w[v] -= coefficient * vector[v];
+                    }
+                }
+            });
+
+            f64 removed = 0;
+            for (usize i = 0; i <= count; ++i) {
+                coefficients[i] += pass[i];
+                removed += pass[i] * pass[i];
+            }
+
+            // What's left is at least 1 / sqrt(2) of w, the orthonormal basis makes its norm sqrt(|w|^2 - removed)
+            if(pass[count + 1] - removed > .5 * pass[count + 1]) {
+                break;
+            }
+        }
+    }
+
+    // w -= beta * previous, then removes the component along current and returns it: the three term recurrence of Lanczos, which
+    // leaves OrthogonalizeSpectral only the rounding errors to remove
+    static f64 LanczosRecurrence(SpectralContext& context, const std::vector<f64>& previous, f64 beta, const std::vector<f64>& current, std::vector<f64>& w) {
+        usize chunks = context.bounds.size() - 1;
+
+        ParallelForChunks(context.bounds, [&](usize begin, usize end, usize chunk) {
+            f64 sum = 0;
+            for (usize v = begin; v < end; ++v) {
+                w[v] -= beta * previous[v];
+                sum += current[v] * w[v];
+            }
+
+            context.partials[chunk * SpectralReductionStride] = sum;
+        });
+
+        f64 alpha = 0;
+        for (usize chunk = 0; chunk < chunks; ++chunk) {
+            alpha += context.partials[chunk * SpectralReductionStride];
+        }
+
+        ParallelForChunks(context.bounds, [&](usize begin, usize end, usize) {
+            for (usize v = begin; v < end; ++v) {
+                w[v] -= alpha * current[v];
+            }
+        });
+
+        return alpha;
+    }
+
+    static f64 SpectralNorm(SpectralContext& context, const std::vector<f64>& x) {
+        usize chunks = context.bounds.size() - 1;
+
+        ParallelForChunks(context.bounds, [&](usize begin, usize end, usize chunk) {
+            f64 sum = 0;
+            for (usize v = begin; v < end; ++v) {
+                sum += x[v] * x[v];
+            }
+
+            context.partials[chunk * SpectralReductionStride] = sum;
+        });
+
+        f64 total = 0;
+        for (usize chunk = 0; chunk < chunks; ++chunk) {
+            total += context.partials[chunk * SpectralReductionStride];
+        }
+
+        return std::sqrt(total);
+    }
+
+    static void ScaleSpectral(SpectralContext& context, const std::vector<f64>& x, f64 factor, std::vector<f64>& y) {
+        ParallelForChunks(context.bounds, [&](usize begin, usize end, usize) {
+            for (usize v = begin; v < end; ++v) {
+                y[v] = factor * x[v];
+            }
+        });
+    }
+
+    // Unit random vector orthogonal to the trivial eigenvector and basis[0, count), used to start and whenever Lanczos finds
+    // an invariant subspace (the Krylov space ran out of new directions)
+    static void RandomOrthogonal(SpectralContext& context, std::vector<std::vector<f64>>& basis, usize count, u64 seed, std::vector<f64>& coefficients) {
+        std::vector<f64>& vector = basis[count];
+
+        ParallelForChunks(context.bounds, [&](usize begin, usize end, usize) {
+            for (usize v = begin; v < end; ++v) {
+                vector[v] = CounterRandom(seed, v).NextUnit() - .5;
+            }
+        });
+
+        OrthogonalizeSpectral(context, basis, count, vector, coefficients);
+        ScaleSpectral(context, vector, 1. / SpectralNorm(context, vector), vector);
+    }
+
+    SpectralLayoutResult SpectralLayout(const GraphCSR& csr, const SpectralLayoutOptions& options) {
+        usize verticesCount = csr.Vertices();
+        std::vector<f32> positions(2 * verticesCount);
+
+        // Nothing to solve, the complement of the trivial eigenvector has at most one dimension
+        if(verticesCount < 3) {
+            if(verticesCount == 2) {
+                positions[0] = -.5f * options.scaling;
+                positions[2] = .5f * options.scaling;
+            }
+
+            return SpectralLayoutResult{std::move(positions), 0, true};
+        }
+
+        constexpr usize Wanted = 2;
+        usize threads = ResolveThreads(options.threads);
+
+        SpectralContext context{
+            csr,
+            BalancedBounds(csr, threads),
+            std::vector<f64>(verticesCount),
+            std::vector<f64>(verticesCount),
+            0.,
+            std::vector<f64>(verticesCount),
+            std::vector<f64>()
+        };
+
+        const f64 tau = options.regularization * static_cast<f64>(csr.Entries()) / static_cast<f64>(verticesCount);
+        context.teleport = tau / static_cast<f64>(verticesCount);
+        context.partials.resize((context.bounds.size() - 1) * SpectralReductionStride);
+
+        f64 trivialNorm = 0;
+        for (usize v = 0; v < verticesCount; ++v) {
+            f64 degree = static_cast<f64>(csr.Degree(v)) + tau;
+
+            context.inverseSqrtDegrees[v] = degree > 0 ? 1. / std::sqrt(degree) : 0.;
+            context.trivial[v] = std::sqrt(degree);
+            trivialNorm += degree;
+        }
+
+        // Without regularization an edgeless graph has no trivial eigenvector to deflate, any direction is as good
+        if(trivialNorm > 0) {
+            ScaleSpectral(context, context.trivial, 1. / std::sqrt(trivialNorm), context.trivial);
+        }
+
+        // The trivial eigenvector takes one dimension away
+        usize size = std::min(std::max<usize>(options.basisSize, Wanted + 2), verticesCount - 1);
+        usize keep = std::max<usize>(Wanted + 1, size / 2);
+        if(keep >= size) {
+            keep = size - 1;
+        }
+
+        std::vector<std::vector<f64>> basis(size, std::vector<f64>(verticesCount));
+        std::vector<f64> w(verticesCount);
+        std::vector<f64> coefficients(size + 1);
+        std::vector<f64> projected(size * size, 0.);
+        std::vector<f64> ritzValues, ritzVectors;
+
+        u64 restarts = 0;
+        RandomOrthogonal(context, basis, 0, options.seed, coefficients);
+
+        usize kept = 0;
+        usize iterations = 0;
+        f64 beta = 0;
+        bool converged = false;
+
+        while(true) {
+            for (usize j = kept; j < size; ++j) {
+                if(options.stop.stop_requested()) {
+                    return SpectralLayoutResult{std::move(positions), iterations, false};
+                }
+
+                ApplySpectralOperator(context, basis[j], w);
+                ++iterations;
+
+                // Right after a restart w is coupled to every kept Ritz vector, afterwards only to the last two vectors
+                if(j > kept) {
+                    const f64 previous = projected[(j - 1) * size + j];
+                    const f64 alpha = LanczosRecurrence(context, basis[j - 1], previous, basis[j], w);
+
+                    OrthogonalizeSpectral(context, basis, j + 1, w, coefficients);
+                    coefficients[j - 1] += previous;
+                    coefficients[j] += alpha;
+                } else {
+                    OrthogonalizeSpectral(context, basis, j + 1, w, coefficients);
+                }
+
+                for (usize i = 0; i <= j; ++i) {
+                    projected[i * size + j] = projected[j * size + i] = coefficients[i];
+                }
+
+                beta = SpectralNorm(context, w);
+                if(j + 1 == size) {
+                    break;
+                }
+
+                if(beta < 1e-10) {
+                    RandomOrthogonal(context, basis, j + 1, options.seed ^ ++restarts * 0x9E3779B97F4A7C15ull, coefficients);
+                    projected[j * size + j + 1] = projected[(j + 1) * size + j] = 0.;
+                    continue;
+                }
+
+                ScaleSpectral(context, w, 1. / beta, basis[j + 1]);
+                projected[j * size + j + 1] = projected[(j + 1) * size + j] = beta;
+            }
+
+            SymmetricEigen(projected, size, ritzValues, ritzVectors);
+
+            // || M y - theta y || of a Ritz pair is beta times the last component of its vector in the basis
+            converged = true;
+            for (usize c = 0; c < Wanted; ++c) {
+                converged &= beta * std::abs(ritzVectors[(size - 1) * size + c]) < options.tolerance;
+            }
+
+            if(converged || iterations >= options.maxIterations) {
+                break;
+            }
+
+            // Thick restart: the best Ritz vectors become the new basis, followed by the residual
+            ParallelForChunks(context.bounds, [&](usize begin, usize end, usize) {
+                std::vector<f64> combined(keep);
+
+                for (usize v = begin; v < end; ++v) {
+                    std::fill(combined.begin(), combined.end(), 0.);
+
+                    for (usize i = 0; i < size; ++i) {
+                        const f64 component = basis[i][v];
+                        const f64* ritz = ritzVectors.data() + i * size;
+
+                        for (usize c = 0; c < keep; ++c) {
+                            combined[c] += component * ritz[c];
+                        }
+                    }
+
+                    for (usize c = 0; c < keep; ++c) {
+                        basis[c][v] = combined[c];
+                    }
+                }
+            });
+
+            if(beta < 1e-10) {
+                RandomOrthogonal(context, basis, keep, options.seed ^ ++restarts * 0x9E3779B97F4A7C15ull, coefficients);
+            } else {
+                ScaleSpectral(context, w, 1. / beta, basis[keep]);
+            }
+
+            std::fill(projected.begin(), projected.end(), 0.);
+            for (usize c = 0; c < keep; ++c) {
+                projected[c * size + c] = ritzValues[c];
+            }
+
+            kept = keep;
+        }
+
+        // Degree normalized eigenvectors x = D^-1/2 u
+        ParallelForChunks(context.bounds, [&](usize begin, usize end, usize) {
+            for (usize v = begin; v < end; ++v) {
+                for (usize c = 0; c < Wanted; ++c) {
+                    f64 sum = 0;
+                    for (usize i = 0; i < size; ++i) {
+                        sum += basis[i][v] * ritzVectors[i * size + c];
+                    }
+
+                    positions[2 * v + c] = static_cast<f32>(context.inverseSqrtDegrees[v] != 0. ? context.inverseSqrtDegrees[v] * sum : sum);
+                }
+            }
+        });
+
+        // Eigenvectors have unit norm, scale them so the mean edge has the requested length
+        ParallelForChunks(context.bounds, [&](usize begin, usize end, usize chunk) {
+            f64 sum = 0;
+            for (usize v = begin; v < end; ++v) {
+                for (const usize u : csr.Adjacent(v)) {
+                    f64 dx = positions[2 * v] - positions[2 * u], dy = positions[2 * v + 1] - positions[2 * u + 1];
+                    sum += std::sqrt(dx * dx + dy * dy);
+                }
+            }
+
+            context.partials[chunk * SpectralReductionStride] = sum;
+        });
+
+        f64 length = 0;
+        for (usize chunk = 0; chunk + 1 < context.bounds.size(); ++chunk) {
+            length += context.partials[chunk * SpectralReductionStride];
+        }
+
+        length = csr.Entries() != 0 ? length / static_cast<f64>(csr.Entries()) : 0.;
+        const f32 scale = length > 0 ? static_cast<f32>(options.scaling / length) : options.scaling * std::sqrt(static_cast<f32>(verticesCount));
+
+        for (f32& position : positions) {
+            position *= scale;
+        }
+
+        return SpectralLayoutResult{std::move(positions), iterations, converged};
+    }
+
+    SpectralLayoutResult SpectralLayout(const Graph& graph, const SpectralLayoutOptions& options) {
+        return SpectralLayout(CreateCSR(graph, CSRDirection::Both), options);
+    }
+} // namespace gpx
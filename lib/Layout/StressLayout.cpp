@@ -0,0 +1,483 @@
+#include <Graphexia/Layout/StressLayout.hpp>
+#include <Graphexia/Parallel.hpp>
+#include <Graphexia/Random.hpp>
+#include <Graphexia/SymmetricEigen.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+namespace gpx {
+    static constexpr u16 NoHops = StressLayoutState::NoHops;
+
+    // Per chunk reductions, padded to avoid false sharing between threads
+    struct alignas(64) StressReduction {
+        f64 first;
+        f64 second;
+        usize vertex;
+        u16 hops;
+    };
+
+    // Level synchronous BFS, every level is split between the threads and vertices are claimed with a CAS on their distance.
+    // A stop request leaves the rest unreached.
+    static void PivotBFS(const GraphCSR& csr, usize source, usize threads, const std::stop_token& stop, std::vector<u16>& distances, std::vector<usize>& frontier, std::vector<std::vector<usize>>& parts) {
+        ParallelFor(0, distances.size(), threads, [&](usize begin, usize end, usize) {
+            std::fill(distances.begin() + begin, distances.begin() + end, NoHops);
+        });
+
+        distances[source] = 0;
+        frontier.assign(1, source);
+
+        u16 level = 0;
+        while(!frontier.empty() && !stop.stop_requested()) {
+            level = std::min<u16>(level + 1, NoHops - 1);
+
+            for (std::vector<usize>& part : parts) {
+                part.clear();
+            }
+
+            ParallelFor(0, frontier.size(), threads, [&](usize begin, usize end, usize thread) {
+                std::vector<usize>& next = parts[thread];
+
+                for (usize i = begin; i < end; ++i) {
+                    for (const usize u : csr.Adjacent(frontier[i])) {
+                        std::atomic_ref<u16> distance(distances[u]);
+                        u16 expected = NoHops;
+
+                        if(distance.load(std::memory_order_relaxed) == NoHops && distance.compare_exchange_strong(expected, level, std::memory_order_relaxed)) {
+                            next.push_back(u);
+                        }
+                    }
+                }
+            }, 256);
+
+            frontier.clear();
+            for (const std::vector<usize>& part : parts) {
+                frontier.insert(frontier.end(), part.begin(), part.end());
+            }
+        }
+    }
+
+    // Picks the pivots (max-min: every pivot is the vertex farthest from the ones before it) and fills hops / regions
+    static void SelectPivots(StressLayoutState& state, usize pivotCount, usize threads) {
+        const GraphCSR& csr = state.csr;
+        usize verticesCount = csr.Vertices();
+        usize chunks = state.bounds.size() - 1;
+
+        std::vector<u16> distances(verticesCount);
+        std::vector<u16> closest(verticesCount, NoHops);
+        std::vector<u32> region(verticesCount);
+        std::vector<usize> frontier;
+        std::vector<std::vector<usize>> parts(ResolveThreads(threads));
+        std::vector<StressReduction> reductions(chunks);
+
+        state.hops.assign(verticesCount * pivotCount, NoHops);
+
+        usize pivot = CounterRandom(state.options.seed).NextBelow(verticesCount);
+        for (usize p = 0; p < pivotCount; ++p) {
+            state.pivots.push_back(pivot);
+            PivotBFS(csr, pivot, threads, state.options.stop, distances, frontier, parts);
+
+            std::fill(reductions.begin(), reductions.end(), StressReduction{});
+            ParallelForChunks(state.bounds, [&](usize begin, usize end, usize chunk) {
+                StressReduction& farthest = reductions[chunk];
+
+                for (usize v = begin; v < end; ++v) {
+                    state.hops[v * pivotCount + p] = distances[v];
+
+                    if(distances[v] < closest[v]) {
+                        closest[v] = distances[v];
+                        region[v] = static_cast<u32>(p);
+                    }
+
+                    // Unreachable vertices come first, every component gets a pivot
+                    if(closest[v] > farthest.hops) {
+                        farthest.hops = closest[v];
+                        farthest.vertex = v;
+                    }
+                }
+            });
+
+            StressReduction farthest{};
+            for (const StressReduction& reduction : reductions) {
+                if(reduction.hops > farthest.hops) {
+                    farthest = reduction;
+                }
+            }
+
+            // Every vertex is a pivot already
+            if(farthest.hops == 0 || state.options.stop.stop_requested()) {
+                break;
+            }
+
+            pivot = farthest.vertex;
+        }
+
+        // Vertices of every region by hops to their pivot, then cumulated
+        pivotCount = state.pivots.size();
+        // Vertices no pivot reaches (there are more components than pivots) belong to no region
+        std::vector<u16> regionHops(pivotCount);
+        for (usize v = 0; v < verticesCount; ++v) {
+            if(closest[v] != NoHops) {
+                regionHops[region[v]] = std::max(regionHops[region[v]], closest[v]);
+            }
+        }
+
+        state.regionOffsets.resize(pivotCount + 1);
+        for (usize p = 0; p < pivotCount; ++p) {
+            state.regionOffsets[p + 1] = state.regionOffsets[p] + regionHops[p] + 1;
+        }
+
+        state.regionCounts.assign(state.regionOffsets.back(), 0);
+        for (usize v = 0; v < verticesCount; ++v) {
+            if(closest[v] != NoHops) {
+                ++state.regionCounts[state.regionOffsets[region[v]] + closest[v]];
+            }
+        }
+
+        for (usize p = 0; p < pivotCount; ++p) {
+            for (usize i = state.regionOffsets[p] + 1; i < state.regionOffsets[p + 1]; ++i) {
+                state.regionCounts[i] += state.regionCounts[i - 1];
+            }
+        }
+    }
+
+    // Classical MDS over the double centered squared distances to the pivots, C. The coordinates are C v for the two largest
+    // eigenvectors of C^T C, which is pivots x pivots, so C is never stored.
+    static void PivotMDS(StressLayoutState& state) {
+        usize verticesCount = state.csr.Vertices();
+        usize pivotCount = state.pivots.size();
+        usize chunks = state.bounds.size() - 1;
+
+        // Unreachable pivots are placed a bit farther than anything reachable
+        u16 farthest = 0;
+        for (const u16 hops : state.hops) {
+            if(hops != NoHops) {
+                farthest = std::max(farthest, hops);
+            }
+        }
+
+        auto squared = [&](u16 hops) {
+            f64 distance = hops == NoHops ? farthest + 1. : static_cast<f64>(hops);
+            return distance * distance;
+        };
+
+        std::vector<f64> columnMeans(pivotCount);
+        std::vector<f64> partialMeans(chunks * pivotCount);
+        ParallelForChunks(state.bounds, [&](usize begin, usize end, usize chunk) {
+            f64* means = partialMeans.data() + chunk * pivotCount;
+
+            for (usize v = begin; v < end; ++v) {
+                for (usize p = 0; p < pivotCount; ++p) {
+                    means[p] += squared(state.hops[v * pivotCount + p]);
+                }
+            }
+        });
+
+        f64 grandMean = 0;
+        for (usize p = 0; p < pivotCount; ++p) {
+            for (usize chunk = 0; chunk < chunks; ++chunk) {
+                columnMeans[p] += partialMeans[chunk * pivotCount + p];
+            }
+
+            columnMeans[p] /= static_cast<f64>(verticesCount);
+            grandMean += columnMeans[p] / static_cast<f64>(pivotCount);
+        }
+
+        // C_vp = -(d_vp^2 - mean of row v - mean of column p + grand mean) / 2
+        auto centered = [&](usize v, f64* row) {
+            f64 rowMean = 0;
+            for (usize p = 0; p < pivotCount; ++p) {
+                row[p] = squared(state.hops[v * pivotCount + p]);
+                rowMean += row[p];
+            }
+
+            rowMean /= static_cast<f64>(pivotCount);
+            for (usize p = 0; p < pivotCount; ++p) {
+                row[p] = -.5 * (row[p] - rowMean - columnMeans[p] + grandMean);
+            }
+        };
+
+        std::vector<f64> partialProducts(chunks * pivotCount * pivotCount);
+        ParallelForChunks(state.bounds, [&](usize begin, usize end, usize chunk) {
+            f64* product = partialProducts.data() + chunk * pivotCount * pivotCount;
+            std::vector<f64> row(pivotCount);
+
+            for (usize v = begin; v < end; ++v) {
+                centered(v, row.data());
+
+                for (usize p = 0; p < pivotCount; ++p) {
+                    const f64 value = row[p];
+                    f64* target = product + p * pivotCount;
+
+                    for (usize q = p; q < pivotCount; ++q) {
+                        target[q] += value * row[q];
+                    }
+                }
+            }
+        });
+
+        std::vector<f64> product(pivotCount * pivotCount);
+        for (usize p = 0; p < pivotCount; ++p) {
+            for (usize q = p; q < pivotCount; ++q) {
+                f64 sum = 0;
+                for (usize chunk = 0; chunk < chunks; ++chunk) {
+                    sum += partialProducts[(chunk * pivotCount + p) * pivotCount + q];
+                }
+
+                product[p * pivotCount + q] = product[q * pivotCount + p] = sum;
+            }
+        }
+
+        std::vector<f64> values, vectors;
+        SymmetricEigen(std::move(product), pivotCount, values, vectors);
+
+        // C^T C has the squared eigenvalues of the (unknown) full MDS matrix, whose square roots scale every axis
+        f64 axisScales[2];
+        for (usize axis = 0; axis < 2; ++axis) {
+            axisScales[axis] = axis < pivotCount && values[axis] > 0 ? 1. / std::pow(values[axis], .25) : 0.;
+        }
+
+        ParallelForChunks(state.bounds, [&](usize begin, usize end, usize) {
+            std::vector<f64> row(pivotCount);
+
+            for (usize v = begin; v < end; ++v) {
+                centered(v, row.data());
+
+                f64 coordinates[2] = {};
+                for (usize p = 0; p < pivotCount; ++p) {
+                    coordinates[0] += row[p] * vectors[p * pivotCount];
+                    coordinates[1] += pivotCount > 1 ? row[p] * vectors[p * pivotCount + 1] : 0.;
+                }
+
+                state.x[v] = static_cast<f32>(coordinates[0] * axisScales[0]);
+                state.y[v] = static_cast<f32>(coordinates[1] * axisScales[1]);
+            }
+        });
+
+        // The scale minimizing the stress between the vertices and the pivots, sum(w d e) / sum(w e^2) with w = 1 / d^2
+        std::vector<StressReduction> reductions(chunks);
+        ParallelForChunks(state.bounds, [&](usize begin, usize end, usize chunk) {
+            StressReduction& reduction = reductions[chunk];
+
+            for (usize v = begin; v < end; ++v) {
+                for (usize p = 0; p < pivotCount; ++p) {
+                    const u16 hops = state.hops[v * pivotCount + p];
+                    if(hops == 0 || hops == NoHops) {
+                        continue;
+                    }
+
+                    const f64 dx = state.x[v] - state.x[state.pivots[p]], dy = state.y[v] - state.y[state.pivots[p]];
+                    const f64 distance = std::sqrt(dx * dx + dy * dy);
+
+                    reduction.first += distance / hops;
+                    reduction.second += distance * distance / (static_cast<f64>(hops) * hops);
+                }
+            }
+        });
+
+        f64 numerator = 0, denominator = 0;
+        for (const StressReduction& reduction : reductions) {
+            numerator += reduction.first;
+            denominator += reduction.second;
+        }
+
+        const f32 scale = denominator > 0 ? static_cast<f32>(state.options.scaling * numerator / denominator) : state.options.scaling;
+        ParallelForChunks(state.bounds, [&](usize begin, usize end, usize) {
+            for (usize v = begin; v < end; ++v) {
+                state.x[v] *= scale;
+                state.y[v] *= scale;
+            }
+        });
+    }
+
+    StressLayoutState SetupStressLayout(GraphCSR&& csr, const StressLayoutOptions& options) {
+        usize verticesCount = csr.Vertices();
+        usize threads = ResolveThreads(options.threads);
+
+        StressLayoutState state{
+            options,
+            std::move(csr),
+            std::vector<usize>(),
+            std::vector<usize>(),
+            std::vector<u16>(),
+            std::vector<usize>(),
+            std::vector<u32>(),
+            std::vector<f32>(verticesCount),
+            std::vector<f32>(verticesCount),
+            std::vector<f32>(verticesCount),
+            std::vector<f32>(verticesCount),
+            0.f,
+            0
+        };
+
+        if(verticesCount == 0) {
+            return state;
+        }
+
+        state.bounds = BalancedBounds(state.csr, threads);
+        SelectPivots(state, std::clamp<usize>(options.pivots, 1, verticesCount), threads);
+
+        // Only pivots were picked, the hops were stored with the requested amount
+        usize pivotCount = state.pivots.size();
+        usize requested = std::clamp<usize>(options.pivots, 1, verticesCount);
+        if(pivotCount != requested) {
+            std::vector<u16> hops(verticesCount * pivotCount);
+            for (usize v = 0; v < verticesCount; ++v) {
+                std::copy_n(state.hops.begin() + v * requested, pivotCount, hops.begin() + v * pivotCount);
+            }
+
+            state.hops = std::move(hops);
+        }
+
+        if(options.stop.stop_requested()) {
+            return state;
+        }
+
+        PivotMDS(state);
+        return state;
+    }
+
+    StressLayoutState SetupStressLayout(const Graph& graph, const StressLayoutOptions& options) {
+        return SetupStressLayout(CreateCSR(graph, CSRDirection::Both), options);
+    }
+
+    // Sum of weight[p] * (pivot + length[p] * (v - pivot) / |v - pivot|) and of the weights. Accumulated in 8 independent lanes, as
+    // the repulsion of the force layout, so the square roots and divides run as SIMD.
+    static void PullTowardsPivots(const f32* pivotX, const f32* pivotY, const f32* lengths, const f32* weights, usize count, f32 x, f32 y, f32& sumX, f32& sumY, f32& sumWeights) {
+        constexpr usize Lanes = 8;
+        f32 lanesX[Lanes] = {}, lanesY[Lanes] = {}, lanesWeights[Lanes] = {};
+
+        // Coincident points only keep the pivot term, dx and dy are 0 anyway
+        auto pull = [&](usize i, usize lane) {
+            const f32 dx = x - pivotX[i], dy = y - pivotY[i];
+            const f32 factor = lengths[i] / std::max(std::sqrt(dx * dx + dy * dy), 1e-6f);
+
+            lanesX[lane] += weights[i] * (pivotX[i] + factor * dx);
+            lanesY[lane] += weights[i] * (pivotY[i] + factor * dy);
+            lanesWeights[lane] += weights[i];
+        };
+
+        usize i = 0;
+        for (; i + Lanes <= count; i += Lanes) {
+            for (usize k = 0; k < Lanes; ++k) {
+                pull(i + k, k);
+            }
+        }
+
+        for (; i < count; ++i) {
+            pull(i, 0);
+        }
+
+        for (usize k = 0; k < Lanes; ++k) {
+            sumX += lanesX[k];
+            sumY += lanesY[k];
+            sumWeights += lanesWeights[k];
+        }
+    }
+
+    bool IterateStressLayout(StressLayoutState& state) {
+        usize verticesCount = state.csr.Vertices();
+        if(state.iteration >= state.options.maxIterations || verticesCount == 0) {
+            return true;
+        }
+
+        const usize pivotCount = state.pivots.size();
+        const f32 edgeLength = state.options.scaling;
+        const f32 edgeWeight = 1.f / (edgeLength * edgeLength);
+
+        // Everything the pivot terms need besides the hops, small enough to stay in L1
+        std::vector<f32> pivotX(pivotCount), pivotY(pivotCount);
+        std::vector<u32> regionBegin(pivotCount), regionLast(pivotCount);
+        for (usize p = 0; p < pivotCount; ++p) {
+            pivotX[p] = state.x[state.pivots[p]];
+            pivotY[p] = state.y[state.pivots[p]];
+            regionBegin[p] = static_cast<u32>(state.regionOffsets[p]);
+            regionLast[p] = static_cast<u32>(state.regionOffsets[p + 1] - state.regionOffsets[p] - 1);
+        }
+
+        std::vector<StressReduction> reductions(state.bounds.size() - 1);
+        ParallelForChunks(state.bounds, [&](usize begin, usize end, usize chunk) {
+            std::vector<f32> lengths(pivotCount), pivotWeights(pivotCount);
+            f64 displacement = 0;
+
+            for (usize v = begin; v < end; ++v) {
+                const f32 x = state.x[v], y = state.y[v];
+                f32 sumX = 0, sumY = 0, weights = 0;
+
+                // Moves v to where the term wants it: 'length' away from (toX, toY) along their current direction
+                auto pull = [&](f32 toX, f32 toY, f32 length, f32 weight) {
+                    const f32 dx = x - toX, dy = y - toY;
+                    const f32 distance = std::sqrt(dx * dx + dy * dy);
+                    const f32 factor = distance > 1e-6f ? length / distance : 0.f;
+
+                    sumX += weight * (toX + factor * dx);
+                    sumY += weight * (toY + factor * dy);
+                    weights += weight;
+                };
+
+                for (const usize u : state.csr.Adjacent(v)) {
+                    if(u != v) {
+                        pull(state.x[u], state.y[u], edgeLength, edgeWeight);
+                    }
+                }
+
+                // Weights first, the pulls are a separate loop free of gathers.
+                // Pivots that v is or can't reach get a weight of 0.
+                const u16* hops = state.hops.data() + v * pivotCount;
+                for (usize p = 0; p < pivotCount; ++p) {
+                    const u32 pivotHops = hops[p];
+                    const f32 length = edgeLength * static_cast<f32>(pivotHops);
+
+                    // Vertices of the region of p at most half as far from p as v, they're all about as far from v as p is
+                    const u32 within = state.regionCounts[regionBegin[p] + std::min(pivotHops / 2, regionLast[p])];
+
+                    lengths[p] = length;
+                    pivotWeights[p] = pivotHops != 0 && pivotHops != NoHops ? static_cast<f32>(within) / (length * length) : 0.f;
+                }
+
+                PullTowardsPivots(pivotX.data(), pivotY.data(), lengths.data(), pivotWeights.data(), pivotCount, x, y, sumX, sumY, weights);
+
+                if(weights == 0) {
+                    state.nextX[v] = x;
+                    state.nextY[v] = y;
+                    continue;
+                }
+
+                state.nextX[v] = sumX / weights;
+                state.nextY[v] = sumY / weights;
+
+                const f32 dx = state.nextX[v] - x, dy = state.nextY[v] - y;
+                displacement += std::sqrt(dx * dx + dy * dy);
+            }
+
+            reductions[chunk].first = displacement;
+        });
+
+        f64 displacement = 0;
+        for (const StressReduction& reduction : reductions) {
+            displacement += reduction.first;
+        }
+
+        state.x.swap(state.nextX);
+        state.y.swap(state.nextY);
+        state.displacement = static_cast<f32>(displacement / static_cast<f64>(verticesCount));
+        ++state.iteration;
+
+        return state.iteration >= state.options.maxIterations || state.displacement < state.options.tolerance * state.options.scaling;
+    }
+
+    std::vector<f32> StressLayout(const Graph& graph, const StressLayoutOptions& options) {
+        StressLayoutState state = SetupStressLayout(graph, options);
+        while(!IterateStressLayout(state)) {
+        }
+
+        std::vector<f32> positions(2 * state.x.size());
+        for (usize v = 0; v < state.x.size(); ++v) {
+            positions[2 * v] = state.x[v];
+            positions[2 * v + 1] = state.y[v];
+        }
+
+        return positions;
+    }
+} // namespace gpx
@@ -0,0 +1,120 @@
+#include <Graphexia/MappedFile.hpp>
+
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace gpx {
+    std::optional<MappedFile> MappedFile::Open(const std::filesystem::path& path) {
+#ifdef _WIN32
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if(file == INVALID_HANDLE_VALUE) {
+            return std::nullopt;
+        }
+
+        LARGE_INTEGER fileSize;
+        if(!GetFileSizeEx(file, &fileSize)) {
+            CloseHandle(file);
+            return std::nullopt;
+        }
+
+        if(fileSize.QuadPart == 0) { // Empty files cannot be mapped
+            CloseHandle(file);
+            return MappedFile(nullptr, 0, nullptr);
+        }
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+
+        if(mapping == nullptr) {
+            return std::nullopt;
+        }
+
+        const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if(view == nullptr) {
+            CloseHandle(mapping);
+            return std::nullopt;
+        }
+
+        return MappedFile(static_cast<const u8*>(view), static_cast<usize>(fileSize.QuadPart), mapping);
+#else
+        int file = open(path.c_str(), O_RDONLY);
+        if(file < 0) {
+            return std::nullopt;
+        }
+
+        struct stat status;
+        if(fstat(file, &status) != 0) {
+            close(file);
+            return std::nullopt;
+        }
+
+        if(status.st_size == 0) { // Empty files cannot be mapped
+            close(file);
+            return MappedFile(nullptr, 0, nullptr);
+        }
+
+        void* view = mmap(nullptr, static_cast<usize>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        close(file); // The mapping keeps its own reference
+
+        if(view == MAP_FAILED) {
+            return std::nullopt;
+        }
+
+        return MappedFile(static_cast<const u8*>(view), static_cast<usize>(status.st_size), nullptr);
+#endif
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+        : data(std::exchange(other.data, nullptr)), size(std::exchange(other.size, 0)), handle(std::exchange(other.handle, nullptr)) {}
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if(this != &other) {
+            this->Close();
+
+            this->data = std::exchange(other.data, nullptr);
+            this->size = std::exchange(other.size, 0);
+            this->handle = std::exchange(other.handle, nullptr);
+        }
+
+        return *this;
+    }
+
+    MappedFile::~MappedFile() {
+        this->Close();
+    }
+
+    void MappedFile::AdviseSequential() const {
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+        if(this->data) {
+            madvise(const_cast<u8*>(this->data), this->size, MADV_SEQUENTIAL);
+        }
+#endif
+    }
+
+    void MappedFile::Close() {
+        if(this->data == nullptr) {
+            return;
+        }
+
+#ifdef _WIN32
+        UnmapViewOfFile(this->data);
+        CloseHandle(this->handle);
+#else
+        munmap(const_cast<u8*>(this->data), this->size);
+#endif
+
+        this->data = nullptr;
+        this->size = 0;
+        this->handle = nullptr;
+    }
+} // namespace gpx
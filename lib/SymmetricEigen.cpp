@@ -0,0 +1,75 @@
+#include <Graphexia/SymmetricEigen.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace gpx {
+    void SymmetricEigen(std::vector<f64> matrix, usize size, std::vector<f64>& values, std::vector<f64>& vectors) {
+        std::vector<f64> rotations(size * size, 0.);
+        for (usize i = 0; i < size; ++i) {
+            rotations[i * size + i] = 1.;
+        }
+
+        for (usize sweep = 0; sweep < 64; ++sweep) {
+            f64 offDiagonal = 0, diagonal = 0;
+            for (usize p = 0; p < size; ++p) {
+                diagonal += matrix[p * size + p] * matrix[p * size + p];
+
+                for (usize q = p + 1; q < size; ++q) {
+                    offDiagonal += matrix[p * size + q] * matrix[p * size + q];
+                }
+            }
+
+            if(offDiagonal <= 1e-30 * diagonal) {
+                break;
+            }
+
+            for (usize p = 0; p < size; ++p) {
+                for (usize q = p + 1; q < size; ++q) {
+                    const f64 apq = matrix[p * size + q];
+                    if(apq == 0.) {
+                        continue;
+                    }
+
+                    const f64 theta = (matrix[q * size + q] - matrix[p * size + p]) / (2. * apq);
+                    const f64 t = std::abs(theta) > 1e150 ? .5 / theta : std::copysign(1., theta) / (std::abs(theta) + std::sqrt(theta * theta + 1.));
+                    const f64 c = 1. / std::sqrt(t * t + 1.);
+                    const f64 s = t * c;
+
+                    for (usize k = 0; k < size; ++k) {
+                        const f64 akp = matrix[k * size + p], akq = matrix[k * size + q];
+                        matrix[k * size + p] = c * akp - s * akq;
+                        matrix[k * size + q] = s * akp + c * akq;
+                    }
+
+                    for (usize k = 0; k < size; ++k) {
+                        const f64 apk = matrix[p * size + k], aqk = matrix[q * size + k];
+                        matrix[p * size + k] = c * apk - s * aqk;
+                        matrix[q * size + k] = s * apk + c * aqk;
+                    }
+
+                    for (usize k = 0; k < size; ++k) {
+                        const f64 vkp = rotations[k * size + p], vkq = rotations[k * size + q];
+                        rotations[k * size + p] = c * vkp - s * vkq;
+                        rotations[k * size + q] = s * vkp + c * vkq;
+                    }
+                }
+            }
+        }
+
+        std::vector<usize> order(size);
+        std::iota(order.begin(), order.end(), usize(0));
+        std::sort(order.begin(), order.end(), [&](usize a, usize b) { return matrix[a * size + a] > matrix[b * size + b]; });
+
+        values.resize(size);
+        vectors.resize(size * size);
+        for (usize c = 0; c < size; ++c) {
+            values[c] = matrix[order[c] * size + order[c]];
+
+            for (usize k = 0; k < size; ++k) {
+                vectors[k * size + c] = rotations[k * size + order[c]];
+            }
+        }
+    }
+} // namespace gpx
@@ -39,8 +39,18 @@ enum class GraphexiaMode : u8 {
     EditEdges,
 };
 
+enum class ExportFormat : u8 {
+    DOT,
+    GraphML,
+    EdgeList,
+};
+
 constexpr u8x4 Rgba8(u32 value) {
     return { static_cast<u8>(value >> 24), static_cast<u8>((value >> 16) & 0xFF), static_cast<u8>((value >> 8) & 0xFF), static_cast<u8>(value & 0xFF) };
 }
 
+constexpr u32 Rgba8Value(u8x4 color) {
+    return (static_cast<u32>(color.x) << 24) | (static_cast<u32>(color.y) << 16) | (static_cast<u32>(color.z) << 8) | static_cast<u32>(color.w);
+}
+
 #endif
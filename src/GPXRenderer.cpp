@@ -5,6 +5,7 @@
 #include "GPXFontRenderer.hpp"
 #include "Util/EasingTask.hpp"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <format>
@@ -85,6 +86,17 @@ void GPXRenderer::UpdateVertexPosition(usize id, f32x2 position) {
     m.batchedVertices.FlagDirty();
 }
 
+void GPXRenderer::UpdateVertexPositions(std::span<const f32> x, std::span<const f32> y) {
+    auto& batchedVtxData = m.batchedVertices.Data();
+    const usize count = std::min({x.size(), y.size(), m.batchedVertices.BatchedCount()});
+
+    for (usize i = 0; i < count; ++i) {
+        batchedVtxData[i].position = {x[i], y[i]};
+    }
+
+    m.batchedVertices.FlagDirty();
+}
+
 void GPXRenderer::UpdateVertexColor(usize id, u8x4 color) {
     m.batchedVertices.Data().at(id).color = color;
     m.batchedVertices.FlagDirty();
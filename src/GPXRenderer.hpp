@@ -10,6 +10,7 @@
 
 #include <sokol/sokol_gfx.h>
 
+#include <span>
 #include <vector>
 
 // autogenerated...
@@ -44,8 +45,12 @@ public:
     void AddEdge(const gpx::Edge& edge);
 
     void UpdateVertexPosition(usize id, f32x2 position);
+    // Moves the first min(x.size(), y.size()) vertices at once, e.g. a whole layout iteration
+    void UpdateVertexPositions(std::span<const f32> x, std::span<const f32> y);
     void UpdateVertexColor(usize id, u8x4 color);
     void UpdateEdgeColor(usize id, u8x4 color);
+    u8x4 VertexColor(usize id) const { return m.batchedVertices.Data().at(id).color; }
+    u8x4 EdgeColor(usize id) const { return m.batchedEdges.Data().at(id).color; }
     void UpdateWeights();
 
     void EraseVertex(usize id);
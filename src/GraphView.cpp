@@ -1,4 +1,6 @@
 #include "GraphView.hpp"
+
+#include <algorithm>
 #include <vector>
 
 usize GraphView::FindVertex(f32x2 position, usize startingVertex) const {
@@ -11,6 +13,28 @@ usize GraphView::FindVertex(f32x2 position, usize startingVertex) const {
     return NoId;
 }
 
+GraphViewAttributes GraphView::Attributes() const {
+    GraphViewAttributes attributes{std::vector<f32>(2 * this->vertices.size()), std::vector<std::string_view>(this->vertices.size())};
+
+    for (usize i = 0; i < this->vertices.size(); ++i) {
+        const Vertex& vertex = this->vertices[i];
+
+        attributes.positions[2 * i] = vertex.position.x;
+        attributes.positions[2 * i + 1] = vertex.position.y;
+        attributes.labels[i] = std::string_view(vertex.label.data(), vertex.labelSize);
+    }
+
+    return attributes;
+}
+
+void GraphView::MoveVertices(std::span<const f32> x, std::span<const f32> y) {
+    usize count = std::min({this->vertices.size(), x.size(), y.size()});
+
+    for (usize i = 0; i < count; ++i) {
+        this->vertices[i].position = {x[i], y[i]};
+    }
+}
+
 usize GraphView::FindEdge(f32x2 position, f32 minimumDistance) const {
     f32 halfMinimumDistance = minimumDistance / 2.f;
 
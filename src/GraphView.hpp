@@ -2,9 +2,13 @@
 #define _GRAPHEXIA_APP_GRAPHVIEW__HPP_
 
 #include <Graphexia/Graph.hpp>
+#include <Graphexia/VertexAttributes.hpp>
 #include "GraphViewRenderer.hpp"
 
+#include <algorithm>
 #include <array>
+#include <span>
+#include <string_view>
 #include <vector>
 
 struct Vertex {
@@ -23,6 +27,14 @@ struct Vertex {
     }
 };
 
+// Positions and labels of a GraphView laid out as the library writers expect them, labels point into the GraphView
+struct GraphViewAttributes {
+    std::vector<f32> positions;
+    std::vector<std::string_view> labels;
+
+    gpx::VertexAttributes View() const { return gpx::VertexAttributes{this->positions, this->labels, {}}; }
+};
+
 struct GraphView final {
     static constexpr usize NoId = std::numeric_limits<usize>::max();
 
@@ -32,8 +44,24 @@ struct GraphView final {
     template<GraphViewRenderer Renderer>
     constexpr explicit GraphView(const gpx::Graph& graph, Renderer renderer)
         : graph(graph), vertices(std::vector<Vertex>(graph.Vertices())) {
-        for (usize i = 0; i < graph.Vertices(); ++i) {
-            this->vertices[i] = {0, {}, renderer.Render(i), 3};
+        if constexpr (GraphViewBatchRenderer<Renderer>) {
+            constexpr usize BatchSize = 1024;
+            std::array<f32x2, BatchSize> positions;
+
+            for (usize first = 0; first < graph.Vertices(); first += BatchSize) {
+                usize count = std::min(BatchSize, graph.Vertices() - first);
+                renderer.Render(first, std::span(positions).first(count));
+
+                // Already value initialized, only the position and size are left
+                for (usize i = 0; i < count; ++i) {
+                    this->vertices[first + i].position = positions[i];
+                    this->vertices[first + i].size = 3;
+                }
+            }
+        } else {
+            for (usize i = 0; i < graph.Vertices(); ++i) {
+                this->vertices[i] = {0, {}, renderer.Render(i), 3};
+            }
         }
     }
 
@@ -53,9 +81,12 @@ struct GraphView final {
     }
 
     usize FindVertex(f32x2 position, usize startingVertex = NoId) const;
+    GraphViewAttributes Attributes() const;
     usize FindEdge(f32x2 position, f32 minimumDistance = 1) const;
 
     void MoveVertex(usize id, f32x2 position) { this->vertices[id].position = position; }
+    // Every vertex at once, e.g. from a layout
+    void MoveVertices(std::span<const f32> x, std::span<const f32> y);
     Vertex& View(usize id) { return this->vertices[id]; }
 
     f32& EdgeWeight(usize id) { return this->graph.EdgeWeight(id); }
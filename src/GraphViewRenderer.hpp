@@ -3,49 +3,182 @@
 
 #include "Core.hpp"
 
+#include <Graphexia/Random.hpp>
+
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <concepts>
 #include <numbers>
-#include <random>
+#include <span>
 
 template<typename T>
 concept GraphViewRenderer = requires(T renderer) {
     { renderer.Render(usize()) } -> std::same_as<f32x2>;
 };
 
+// Fills the positions of vertices [first, first + positions.size()) at once, same positions as rendering them one by one
+template<typename T>
+concept GraphViewBatchRenderer = GraphViewRenderer<T> && requires(T renderer, std::span<f32x2> positions) {
+    { renderer.Render(usize(), positions) } -> std::same_as<void>;
+};
+
 struct CircularGraphViewRenderer {
     constexpr CircularGraphViewRenderer(f32x2 offset, u32 radius, usize vertices)
         : offset(offset), radius(radius), angleIncrement(2 * std::numbers::pi / vertices) {}
 
     f32x2 Render(usize vertex) {
-        f32 angle = angleIncrement * vertex;
-        f32 sin = std::sin(angle);
-        f32 cos = std::cos(angle);
+        f64 angle = angleIncrement * vertex;
+        f32 sin = static_cast<f32>(std::sin(angle));
+        f32 cos = static_cast<f32>(std::cos(angle));
 
         return { (this->offset.x + cos * radius), (this->offset.y + sin * radius) };
     }
 
+    // Only Lanes sin/cos per call: the lanes are the anchor rotated by k * angleIncrement and the anchor is rotated by
+    // Lanes * angleIncrement every step. The rotation drifts slowly, so the anchor is recomputed every AnchorStride vertices.
+    void Render(usize first, std::span<f32x2> positions) {
+        constexpr usize Lanes = 8;
+        constexpr usize AnchorStride = 1024;
+
+        std::array<f32, Lanes> laneCos, laneSin;
+        for (usize k = 0; k < Lanes; ++k) {
+            laneCos[k] = static_cast<f32>(std::cos(this->angleIncrement * k));
+            laneSin[k] = static_cast<f32>(std::sin(this->angleIncrement * k));
+        }
+
+        f64 stepCos = std::cos(this->angleIncrement * Lanes);
+        f64 stepSin = std::sin(this->angleIncrement * Lanes);
+        f32 r = static_cast<f32>(this->radius);
+
+        for (usize anchor = 0; anchor < positions.size(); anchor += AnchorStride) {
+            usize end = std::min(anchor + AnchorStride, positions.size());
+            f64 angle = this->angleIncrement * (first + anchor);
+            f64 anchorCos = std::cos(angle);
+            f64 anchorSin = std::sin(angle);
+
+            for (usize i = anchor; i < end; i += Lanes) {
+                f32 cos = static_cast<f32>(anchorCos), sin = static_cast<f32>(anchorSin);
+                std::array<f32x2, Lanes> lanes;
+                for (usize k = 0; k < Lanes; ++k) {
+                    lanes[k] = { this->offset.x + (cos * laneCos[k] - sin * laneSin[k]) * r, this->offset.y + (sin * laneCos[k] + cos * laneSin[k]) * r };
+                }
+
+                std::copy_n(lanes.begin(), std::min(Lanes, end - i), positions.begin() + i);
+
+                f64 nextCos = anchorCos * stepCos - anchorSin * stepSin;
+                anchorSin = anchorSin * stepCos + anchorCos * stepSin;
+                anchorCos = nextCos;
+            }
+        }
+    }
+
     private:
         f32x2 offset;
         u32 radius;
-        f32 angleIncrement;
+        f64 angleIncrement;
 };
 
-template<std::uniform_random_bit_generator Generator>
+// Rows of columns vertices, spacing apart and centered on offset. Vertex = row * columns + column like CreateGrid/CreateTorus,
+// 0 columns makes it as square as possible.
+struct GridGraphViewRenderer {
+    GridGraphViewRenderer(f32x2 offset, f32 spacing, usize vertices, usize columns = 0)
+        : columns(std::max<usize>(columns != 0 ? columns : static_cast<usize>(std::ceil(std::sqrt(static_cast<f64>(vertices)))), 1)), spacing(spacing) {
+        usize rows = (vertices + this->columns - 1) / this->columns;
+        this->origin = { offset.x - (this->columns - 1) * spacing / 2, offset.y - (std::max<usize>(rows, 1) - 1) * spacing / 2 };
+    }
+
+    f32x2 Render(usize vertex) {
+        usize row = vertex / this->columns, column = vertex % this->columns;
+        return { this->origin.x + column * this->spacing, this->origin.y + row * this->spacing };
+    }
+
+    // One division per call, then whole rows at a time
+    void Render(usize first, std::span<f32x2> positions) {
+        usize row = first / this->columns, column = first % this->columns;
+
+        for (usize i = 0; i < positions.size(); ++row, column = 0) {
+            usize run = std::min(this->columns - column, positions.size() - i);
+            f32 y = this->origin.y + row * this->spacing;
+
+            for (usize k = 0; k < run; ++k) {
+                positions[i + k] = { this->origin.x + (column + k) * this->spacing, y };
+            }
+
+            i += run;
+        }
+    }
+
+    private:
+        usize columns;
+        f32 spacing;
+        f32x2 origin;
+};
+
+// Every vertex position only depends on (seed, vertex), not on the order vertices are rendered in
 struct RandomGraphViewRenderer {
-    constexpr RandomGraphViewRenderer(f32x2 offset, u32 radius, Generator generator)
-        : offset(offset), radius(radius), generator(generator) {}
+    constexpr RandomGraphViewRenderer(f32x2 offset, u32 radius, u64 seed)
+        : offset(offset), radius(radius), seed(seed) {}
 
-    f32x2 Render(usize) {
-        f32 halfMax = static_cast<f32>(Generator::max()) / 2.f;
-        f32 rX = ((this->generator() - halfMax) / halfMax) * radius;
-        f32 rY = ((this->generator() - halfMax) / halfMax) * radius;
+    f32x2 Render(usize vertex) {
+        gpx::CounterRandom generator(this->seed, vertex);
+        f32 rX = static_cast<f32>(generator.NextUnit() * 2.0 - 1.0) * radius;
+        f32 rY = static_cast<f32>(generator.NextUnit() * 2.0 - 1.0) * radius;
         return { (this->offset.x + rX), (this->offset.y + rY) };
     }
 
+    // The first block of the stream of Lanes vertices at once, the same two numbers CounterRandom would hand out first
+    void Render(usize first, std::span<f32x2> positions) {
+        constexpr usize Lanes = 8;
+        std::array<u32, 2> key = { static_cast<u32>(this->seed), static_cast<u32>(this->seed >> 32) };
+
+        for (usize i = 0; i < positions.size(); i += Lanes) {
+            std::array<std::array<u32, Lanes>, 4> blocks{};
+            for (usize k = 0; k < Lanes; ++k) {
+                u64 vertex = first + i + k;
+                blocks[2][k] = static_cast<u32>(vertex);
+                blocks[3][k] = static_cast<u32>(vertex >> 32);
+            }
+
+            gpx::Philox4x32Lanes(blocks, key);
+
+            std::array<f32x2, Lanes> lanes;
+            for (usize k = 0; k < Lanes; ++k) {
+                // CounterRandom hands out the upper half of a block first. NextUnit() from the two u32 words separately,
+                // it's the same (exact) f64 but u32 -> f64 vectorizes and u64 -> f64 doesn't.
+                f64 unitX = blocks[3][k] * 0x1.0p-32 + (blocks[2][k] >> 11) * 0x1.0p-53;
+                f64 unitY = blocks[1][k] * 0x1.0p-32 + (blocks[0][k] >> 11) * 0x1.0p-53;
+                f32 rX = static_cast<f32>(unitX * 2.0 - 1.0) * radius;
+                f32 rY = static_cast<f32>(unitY * 2.0 - 1.0) * radius;
+                lanes[k] = { (this->offset.x + rX), (this->offset.y + rY) };
+            }
+
+            std::copy_n(lanes.begin(), std::min(Lanes, positions.size() - i), positions.begin() + i);
+        }
+    }
+
     private:
         f32x2 offset;
         u32 radius;
-        Generator generator;
+        u64 seed;
+};
+
+// Positions computed elsewhere (e.g. loaded from a file), (x, y) per vertex
+struct FixedGraphViewRenderer {
+    constexpr FixedGraphViewRenderer(std::span<const f32> positions)
+        : positions(positions) {}
+
+    f32x2 Render(usize vertex) {
+        return { this->positions[2 * vertex], this->positions[2 * vertex + 1] };
+    }
+
+    void Render(usize first, std::span<f32x2> positions) {
+        for (usize i = 0; i < positions.size(); ++i) {
+            positions[i] = { this->positions[2 * (first + i)], this->positions[2 * (first + i) + 1] };
+        }
+    }
+
+    private:
+        std::span<const f32> positions;
 };
 #endif
@@ -4,18 +4,51 @@
 #include "Graphexia/Graph.hpp"
 #include <Graphexia/GraphTypes.hpp>
 #include <Graphexia/Algo/Hakimi.hpp>
+#include <Graphexia/Algo/ConfigurationModel.hpp>
+#include <Graphexia/Algo/Centrality.hpp>
+#include <Graphexia/Algo/Betweenness.hpp>
+#include <Graphexia/Algo/Coloring.hpp>
+#include <Graphexia/Algo/MaxFlow.hpp>
+#include <Graphexia/Algo/Matching.hpp>
+#include <Graphexia/Algo/Topological.hpp>
+#include <Graphexia/Algo/Eulerian.hpp>
+#include <Graphexia/GraphExport.hpp>
+#include <Graphexia/Layout/SpectralLayout.hpp>
 
 #include <chrono>
 #include <sokol/sokol_gfx.h>
 
 #include <optional>
+#include <bit>
 #include <limits>
 #include <algorithm>
+#include <cmath>
 #include <random>
 #include <iostream>
+#include <fstream>
+#include <string>
 
 Graphexia::Graphexia()
-    : view(gpx::CreateKComplete(4), CircularGraphViewRenderer({0,0}, 60, 4)), renderer(), mode(GraphexiaMode::EditVertices), selectedId(GraphView::NoId), movingCamera(false), savedHavelHakimiSequenceLength(), havelHakimiSequence() {
+    : view(std::make_shared<GraphView>(gpx::CreateKComplete(4), CircularGraphViewRenderer({0,0}, 60, 4))), renderer(), mode(GraphexiaMode::EditVertices), selectedId(GraphView::NoId), movingCamera(false), savedHavelHakimiSequenceLength(), hakimiRandomRealization(), havelHakimiSequence(), randomGraphKind(), randomGraphVertices(100), gnpProbability(0.05f), gnmEdges(200), barabasiAlbertEdges(2), wattsStrogatzNeighbours(4), wattsStrogatzRewiring(0.1f), rmatEdges(400), gridWidth(10), coloringColors(), maxFlowSource(0), maxFlowSink(1), maxFlowState(), maxFlowValue(), eulerianStatus(""), layoutModel(), layoutWorker(), exportPath(), exportPathLength(), exportStatus(""), exporting(), exportedView(), workspacePath(), workspacePathLength(), workspaceFile(), journal(), autosaveElapsed(), journalBytes(), snapshotBytes(), workspaceNeedsSnapshot(), workspaceSaving(), workspaceStatus("") {
+}
+
+Graphexia::~Graphexia() {
+#ifndef GRAPHEXIA_NO_THREADS
+    if(this->workspaceWorker.joinable()) {
+        this->workspaceWorker.join();
+    }
+#endif
+
+    // Whatever the last autosave didn't get to
+    if(this->workspaceFile.empty()) {
+        return;
+    }
+
+    if(this->workspaceNeedsSnapshot) {
+        this->SaveWorkspaceSnapshot();
+    } else if(!this->journal.Empty()) {
+        AppendWorkspaceJournal(this->workspaceFile, this->journal.Records());
+    }
 }
 
 void Graphexia::Init() {
@@ -29,7 +62,7 @@ void Graphexia::Init() {
     }
 
     this->renderer = std::move(*renderer);
-    this->renderer.ReconstructView(this->view);
+    this->renderer.ReconstructView(*this->view);
 }
 
 nk_bool FilterSequence(const nk_text_edit*, const nk_rune unicode) {
@@ -37,7 +70,6 @@ nk_bool FilterSequence(const nk_text_edit*, const nk_rune unicode) {
 }
 
 void Graphexia::Update(f32 dt, nk_context* ctx) {
-    const gpx::Graph& graph = this->view.GetGraph();
     nk_style_hide_cursor(ctx);
 
     if(nk_begin(ctx, "Graphexia", nk_rect(0, 0, 350, 450), NK_WINDOW_BORDER | NK_WINDOW_MOVABLE | NK_WINDOW_MINIMIZABLE)) {
@@ -70,32 +102,203 @@ void Graphexia::Update(f32 dt, nk_context* ctx) {
 
         nk_layout_row_dynamic(ctx, 30, 1);
         if(nk_button_label(ctx, "Reset Graph")) {
-            this->view = GraphView();
-            this->selectionType = SelectionType::None;
-            this->selectedId = GraphView::NoId;
-            this->renderer.ReconstructView(this->view);
+            this->ReplaceView(GraphView());
         }
 
         // HACK
         if(nk_button_label(ctx, "Clear Graph Color")) {
-            for (usize i = 0; i < graph.Vertices(); ++i) {
+            for (usize i = 0; i < this->view->GetGraph().Vertices(); ++i) {
                 this->renderer.UpdateVertexColor(i, Rgba8(0xFFFFFFFF)); 
             }
 
-            for (usize i = 0; i < graph.Edges().size(); ++i) {
+            for (usize i = 0; i < this->view->GetGraph().Edges().size(); ++i) {
                 this->renderer.UpdateEdgeColor(i, Rgba8(0xFFFFFFFF)); 
             }
         }
 
+        nk_layout_row_dynamic(ctx, 14, 1);
+        if(nk_tree_push(ctx, NK_TREE_TAB, "Layout", NK_MINIMIZED)) {
+            static const char* models[] = { "ForceAtlas2", "Fruchterman-Reingold" };
+
+            nk_layout_row_dynamic(ctx, 20, 1);
+            this->layoutModel = nk_combo(ctx, models, 2, this->layoutModel, 20, nk_vec2(200, 80));
+
+            if(this->layoutWorker) {
+                const LayoutWorker::Snapshot& snapshot = this->layoutWorker->Current();
+                if(snapshot.level != 0) {
+                    nk_labelf(ctx, NK_TEXT_LEFT, "Level %zu, iteration %zu", snapshot.level, snapshot.iteration);
+                } else {
+                    nk_labelf(ctx, NK_TEXT_LEFT, "Iteration %zu, moved %.3f", snapshot.iteration, snapshot.displacement);
+                }
+
+                if(nk_button_label(ctx, "Stop")) {
+                    this->StopLayout();
+                }
+            } else {
+                gpx::ForceLayoutOptions options;
+                options.model = this->layoutModel == 0 ? gpx::ForceModel::ForceAtlas2 : gpx::ForceModel::FruchtermanReingold;
+                options.scaling = this->layoutModel == 0 ? 50.f : 20.f;
+                // Leave a core to the UI
+                options.threads = std::max<usize>(gpx::ResolveThreads(0), 2) - 1;
+
+                // Every layout works on its own copy of the graph, built in the worker
+                nk_layout_row_dynamic(ctx, 20, 2);
+                if(nk_button_label(ctx, "Force Layout")) {
+                    GraphViewAttributes attributes = this->view->Attributes();
+                    std::vector<f32> positions(attributes.positions.begin(), attributes.positions.end());
+
+                    this->layoutWorker.emplace([csr = gpx::CreateCSR(this->view->GetGraph(), gpx::CSRDirection::Both), options, positions = std::move(positions)](std::stop_token) mutable {
+                        return LayoutWorker::State(gpx::SetupForceLayout(std::move(csr), options, positions));
+                    });
+                }
+
+                if(nk_button_label(ctx, "Multilevel")) {
+                    gpx::MultilevelLayoutOptions multilevel;
+                    multilevel.force = options;
+                    multilevel.force.seed = sapp_frame_count();
+                    multilevel.coarsening.threads = options.threads;
+
+                    this->layoutWorker.emplace([csr = gpx::CreateCSR(this->view->GetGraph(), gpx::CSRDirection::Both), multilevel](std::stop_token stop) mutable {
+                        multilevel.coarsening.stop = stop;
+                        return LayoutWorker::State(gpx::SetupMultilevelLayout(gpx::CreateCoarseningHierarchy(std::move(csr), multilevel.coarsening), multilevel));
+                    });
+                }
+
+                if(nk_button_label(ctx, "Spectral")) {
+                    gpx::SpectralLayoutOptions spectral;
+                    spectral.scaling = 20.f;
+                    spectral.threads = options.threads;
+
+                    // Refined by the force layout
+                    this->layoutWorker.emplace([csr = gpx::CreateCSR(this->view->GetGraph(), gpx::CSRDirection::Both), spectral, options](std::stop_token stop) mutable {
+                        spectral.stop = stop;
+                        gpx::SpectralLayoutResult seed = gpx::SpectralLayout(csr, spectral);
+                        return LayoutWorker::State(gpx::SetupForceLayout(std::move(csr), options, seed.positions));
+                    });
+                }
+
+                if(nk_button_label(ctx, "Stress")) {
+                    gpx::StressLayoutOptions stress;
+                    stress.scaling = 20.f;
+                    stress.threads = options.threads;
+                    stress.seed = sapp_frame_count();
+
+                    this->layoutWorker.emplace([csr = gpx::CreateCSR(this->view->GetGraph(), gpx::CSRDirection::Both), stress](std::stop_token stop) mutable {
+                        stress.stop = stop;
+                        return LayoutWorker::State(gpx::SetupStressLayout(std::move(csr), stress));
+                    });
+                }
+            }
+
+            nk_tree_pop(ctx);
+        }
+
+        nk_layout_row_dynamic(ctx, 14, 1);
+        if(nk_tree_push(ctx, NK_TREE_TAB, "Workspace", NK_MINIMIZED)) {
+            nk_layout_row_dynamic(ctx, 28, 1);
+            nk_label_wrap(ctx, "Once saved or loaded, the workspace is autosaved every few seconds.");
+
+            nk_layout_row_dynamic(ctx, 20, 1);
+            nk_edit_string(ctx, NK_EDIT_FIELD, this->workspacePath, &this->workspacePathLength, 255, nk_filter_default);
+
+            nk_layout_row_dynamic(ctx, 20, 2);
+            if(nk_button_label(ctx, "Save")) {
+                if(this->workspacePathLength == 0) {
+                    this->workspaceStatus = "Write a path first";
+                } else {
+                    this->workspaceFile = std::string(this->workspacePath, this->workspacePathLength);
+                    this->SaveWorkspaceSnapshot();
+                }
+            }
+
+            if(nk_button_label(ctx, "Load")) {
+                this->LoadWorkspaceFile();
+            }
+
+            nk_layout_row_dynamic(ctx, 14, 1);
+            nk_label(ctx, this->workspaceStatus.load(), NK_TEXT_LEFT);
+
+            nk_tree_pop(ctx);
+        }
+
+        nk_layout_row_dynamic(ctx, 14, 1);
+        if(nk_tree_push(ctx, NK_TREE_TAB, "Export", NK_MINIMIZED)) {
+            nk_layout_row_dynamic(ctx, 20, 1);
+            nk_edit_string(ctx, NK_EDIT_FIELD, this->exportPath, &this->exportPathLength, 255, nk_filter_default);
+
+            nk_layout_row_dynamic(ctx, 20, 3);
+            if(nk_button_label(ctx, "DOT")) {
+                this->ExportView(ExportFormat::DOT);
+            }
+
+            if(nk_button_label(ctx, "GraphML")) {
+                this->ExportView(ExportFormat::GraphML);
+            }
+
+            if(nk_button_label(ctx, "Edge List")) {
+                this->ExportView(ExportFormat::EdgeList);
+            }
+
+            nk_layout_row_dynamic(ctx, 14, 1);
+            nk_label(ctx, this->exportStatus.load(), NK_TEXT_LEFT);
+
+            nk_tree_pop(ctx);
+        }
+
         nk_layout_row_dynamic(ctx, 14, 1);
         if(nk_tree_push(ctx, NK_TREE_TAB, "K Complete Graphs", NK_MINIMIZED)) {
             nk_property_int(ctx, "K", 1, &this->savedSelectedKComplete, 1000, 1, 1);
 
             if(nk_button_label(ctx, "Render K Complete Graph")) {
-                this->view = GraphView(gpx::CreateKComplete(this->savedSelectedKComplete), CircularGraphViewRenderer({}, 10.f + this->savedSelectedKComplete * 2.2f, this->savedSelectedKComplete));
-                this->renderer.ReconstructView(this->view);
-                this->selectionType = SelectionType::None;
-                this->selectedId = GraphView::NoId;
+                this->ReplaceView(GraphView(gpx::CreateKComplete(this->savedSelectedKComplete), CircularGraphViewRenderer({}, 10.f + this->savedSelectedKComplete * 2.2f, this->savedSelectedKComplete)));
+            }
+
+            nk_tree_pop(ctx);
+        }
+
+        nk_layout_row_dynamic(ctx, 14, 1);
+        if(nk_tree_push(ctx, NK_TREE_TAB, "Random Graphs", NK_MINIMIZED)) {
+            static const char* generators[] = { "G(n, p)", "G(n, m)", "Barabasi-Albert", "Watts-Strogatz", "R-MAT", "Grid", "Torus" };
+
+            nk_layout_row_dynamic(ctx, 20, 1);
+            this->randomGraphKind = nk_combo(ctx, generators, 7, this->randomGraphKind, 20, nk_vec2(200, 160));
+
+            nk_layout_row_dynamic(ctx, 14, 1);
+            nk_property_int(ctx, "Vertices", 1, &this->randomGraphVertices, 10000, 1, 1);
+            switch(this->randomGraphKind) {
+                case 0: nk_property_float(ctx, "p", 0.f, &this->gnpProbability, 1.f, 0.01f, 0.005f); break;
+                case 1: nk_property_int(ctx, "Edges", 0, &this->gnmEdges, 100000, 1, 1); break;
+                case 2: nk_property_int(ctx, "Edges per vertex", 1, &this->barabasiAlbertEdges, 100, 1, 1); break;
+                case 3:
+                    nk_property_int(ctx, "Neighbours", 2, &this->wattsStrogatzNeighbours, 100, 2, 1);
+                    nk_property_float(ctx, "Rewiring", 0.f, &this->wattsStrogatzRewiring, 1.f, 0.01f, 0.005f);
+                    break;
+                case 4: nk_property_int(ctx, "Edges", 0, &this->rmatEdges, 100000, 1, 1); break;
+                default: nk_property_int(ctx, "Width", 1, &this->gridWidth, 1000, 1, 1); break;
+            }
+
+            if(nk_button_label(ctx, "Render Random Graph")) {
+                usize vertices = this->randomGraphVertices;
+                usize width = this->gridWidth;
+                u64 seed = sapp_frame_count();
+                gpx::Graph generated;
+
+                switch(this->randomGraphKind) {
+                    case 0: generated = gpx::CreateGnp(vertices, this->gnpProbability, seed); break;
+                    case 1: generated = gpx::CreateGnm(vertices, this->gnmEdges, seed); break;
+                    case 2: generated = gpx::CreateBarabasiAlbert(vertices, this->barabasiAlbertEdges, seed); break;
+                    case 3: generated = gpx::CreateWattsStrogatz(vertices, this->wattsStrogatzNeighbours, this->wattsStrogatzRewiring, seed); break;
+                    case 4: generated = gpx::CreateRMAT(std::bit_width(vertices - 1), this->rmatEdges, 0.57, 0.19, 0.19, seed); break;
+                    case 5: generated = gpx::CreateGrid(width, (vertices + width - 1) / width); break;
+                    default: generated = gpx::CreateTorus(width, (vertices + width - 1) / width); break;
+                }
+
+                usize count = generated.Vertices();
+                if(this->randomGraphKind >= 5) {
+                    this->ReplaceView(GraphView(generated, GridGraphViewRenderer({}, 10.f, count, width)));
+                } else {
+                    this->ReplaceView(GraphView(generated, CircularGraphViewRenderer({}, 10.f + count * 2.2f, count)));
+                }
             }
 
             nk_tree_pop(ctx);
@@ -138,16 +341,18 @@ void Graphexia::Update(f32 dt, nk_context* ctx) {
                 }
 
                 nk_layout_row_dynamic(ctx, 14, 1);
+                nk_checkbox_label(ctx, "Random realization", &this->hakimiRandomRealization);
+
                 if(nk_button_label(ctx, "Render")) {
+                    gpx::Graph realization = this->hakimiRandomRealization
+                        ? gpx::CreateConfigurationModel(this->havelHakimiSequence, sapp_frame_count()).value_or(gpx::Graph())
+                        : gpx::CreateFromGraphicSequence(this->havelHakimiSequence);
+
                     if(this->renderHakimiRandom) {
-                        this->view = GraphView(gpx::CreateFromGraphicSequence(this->havelHakimiSequence), RandomGraphViewRenderer({}, this->havelHakimiSequence.size() * 10, std::default_random_engine{static_cast<u32>(sapp_frame_count())})); 
+                        this->ReplaceView(GraphView(realization, RandomGraphViewRenderer({}, this->havelHakimiSequence.size() * 10, sapp_frame_count()))); 
                     } else {
-                        this->view = GraphView(gpx::CreateFromGraphicSequence(this->havelHakimiSequence), CircularGraphViewRenderer({}, this->havelHakimiSequence.size() * 10, this->havelHakimiSequence.size())); 
-
+                        this->ReplaceView(GraphView(realization, CircularGraphViewRenderer({}, this->havelHakimiSequence.size() * 10, this->havelHakimiSequence.size()))); 
                     }
-                    this->renderer.ReconstructView(this->view);
-                    this->selectionType = SelectionType::None;
-                    this->selectedId = GraphView::NoId;
                 }
             } else {
                 nk_label(ctx, "Is not a graphic sequence", NK_TEXT_LEFT);
@@ -167,16 +372,16 @@ void Graphexia::Update(f32 dt, nk_context* ctx) {
             if(nk_tree_push(ctx, NK_TREE_TAB, "Kruskal", NK_MINIMIZED)) {
                 if(nk_button_label(ctx, "Setup")) {
                     this->ClearLastSelection();
-                    this->kruskalState = gpx::SetupKruskal(this->view.GetGraph());
+                    this->kruskalState = gpx::SetupKruskal(this->view->GetGraph());
                 }
 
                 if(nk_button_label(ctx, "Iterate")) {
                     this->ClearLastSelection(); 
 
-                    gpx::IterateKruskal(this->view.GetGraph(), this->kruskalState);
+                    gpx::IterateKruskal(this->view->GetGraph(), this->kruskalState);
 
                     for (const usize edgeId : this->kruskalState.result) {
-                        const gpx::Edge& edge = graph.Edges()[edgeId];
+                        const gpx::Edge& edge = this->view->GetGraph().Edges()[edgeId];
                         this->renderer.UpdateVertexColor(edge.fromId, Rgba8(0x0000FFFF));
                         this->renderer.UpdateVertexColor(edge.toId, Rgba8(0x0000FFFF));
                         this->renderer.UpdateEdgeColor(edgeId, Rgba8(0x0000FFFF)); 
@@ -188,24 +393,24 @@ void Graphexia::Update(f32 dt, nk_context* ctx) {
 
             if(nk_tree_push(ctx, NK_TREE_TAB, "Search", NK_MINIMIZED)) {
                 nk_label_wrap(ctx, "You can see the id in the 'Selection Info' window");
-                nk_property_int(ctx, "From", 0, &this->initialVertex, graph.Vertices(), 1, 1);
+                nk_property_int(ctx, "From", 0, &this->initialVertex, this->view->GetGraph().Vertices(), 1, 1);
                 nk_label_wrap(ctx, "FYI: -1 means 'No target vertex'");
-                nk_property_int(ctx, "To", -1, &this->endVertex, graph.Vertices(), 1, 1);
+                nk_property_int(ctx, "To", -1, &this->endVertex, this->view->GetGraph().Vertices(), 1, 1);
 
                 nk_spacer(ctx);
 
                 if(nk_button_label(ctx, "Setup BFS")) {
                     this->ClearLastSelection();
-                    this->bfsState = gpx::SetupBFS(this->view.GetGraph(), this->initialVertex, this->endVertex == -1 ? std::nullopt : std::make_optional(this->endVertex));
+                    this->bfsState = gpx::SetupBFS(this->view->GetGraph(), this->initialVertex, this->endVertex == -1 ? std::nullopt : std::make_optional(this->endVertex));
                 }
 
                 if(nk_button_label(ctx, "Iterate BFS")) {
                     this->ClearLastSelection(); 
 
-                    gpx::IterateBFS(this->view.GetGraph(), this->bfsState);
+                    gpx::IterateBFS(this->view->GetGraph(), this->bfsState);
 
                     for (const usize edgeId : this->bfsState.result) {
-                        const gpx::Edge& edge = graph.Edges()[edgeId];
+                        const gpx::Edge& edge = this->view->GetGraph().Edges()[edgeId];
                         this->renderer.UpdateVertexColor(edge.fromId, Rgba8(0x0000FFFF));
                         this->renderer.UpdateVertexColor(edge.toId, Rgba8(0x0000FFFF));
                         this->renderer.UpdateEdgeColor(edgeId, Rgba8(0x0000FFFF)); 
@@ -219,16 +424,16 @@ void Graphexia::Update(f32 dt, nk_context* ctx) {
 
                 if(nk_button_label(ctx, "Setup DFS")) {
                     this->ClearLastSelection();
-                    this->dfsState = gpx::SetupDFS(this->view.GetGraph(), this->initialVertex, this->endVertex == -1 ? std::nullopt : std::make_optional(this->endVertex));
+                    this->dfsState = gpx::SetupDFS(this->view->GetGraph(), this->initialVertex, this->endVertex == -1 ? std::nullopt : std::make_optional(this->endVertex));
                 }
 
                 if(nk_button_label(ctx, "Iterate DFS")) {
                     this->ClearLastSelection(); 
 
-                    gpx::IterateDFS(this->view.GetGraph(), this->dfsState);
+                    gpx::IterateDFS(this->view->GetGraph(), this->dfsState);
 
                     for (const usize edgeId : this->dfsState.result) {
-                        const gpx::Edge& edge = graph.Edges()[edgeId];
+                        const gpx::Edge& edge = this->view->GetGraph().Edges()[edgeId];
                         this->renderer.UpdateVertexColor(edge.fromId, Rgba8(0x0000FFFF));
                         this->renderer.UpdateVertexColor(edge.toId, Rgba8(0x0000FFFF));
                         this->renderer.UpdateEdgeColor(edgeId, Rgba8(0x0000FFFF)); 
@@ -239,6 +444,188 @@ void Graphexia::Update(f32 dt, nk_context* ctx) {
                 nk_tree_pop(ctx);
             }
 
+            if(nk_tree_push(ctx, NK_TREE_TAB, "Max Flow", NK_MINIMIZED)) {
+                nk_label_wrap(ctx, "Edge weights are the capacities");
+                nk_property_int(ctx, "Source", 0, &this->maxFlowSource, this->view->GetGraph().Vertices(), 1, 1);
+                nk_property_int(ctx, "Sink", 0, &this->maxFlowSink, this->view->GetGraph().Vertices(), 1, 1);
+
+                nk_spacer(ctx);
+
+                bool validTerminals = this->maxFlowSource >= 0 && this->maxFlowSink >= 0 && static_cast<usize>(this->maxFlowSource) < this->view->GetGraph().Vertices() && static_cast<usize>(this->maxFlowSink) < this->view->GetGraph().Vertices();
+                if(nk_button_label(ctx, "Setup") && validTerminals) {
+                    this->ClearLastSelection();
+                    this->maxFlowState = gpx::SetupMaxFlow(this->view->GetGraph(), this->maxFlowSource, this->maxFlowSink);
+                    this->maxFlowValue = 0;
+                }
+
+                if(nk_button_label(ctx, "Iterate") && !this->maxFlowState.labels.empty()) {
+                    this->ClearLastSelection();
+
+                    gpx::IterateMaxFlow(this->view->GetGraph(), this->maxFlowState);
+                    this->maxFlowValue = this->maxFlowState.excess[this->maxFlowState.sink];
+
+                    for (const usize edgeId : this->maxFlowState.result) {
+                        this->renderer.UpdateEdgeColor(edgeId, Rgba8(0x0000FFFF));
+                    }
+
+                    this->renderer.UpdateVertexColor(this->maxFlowState.current, Rgba8(0xFF0000FF));
+                }
+
+                if(nk_button_label(ctx, "Run") && validTerminals) {
+                    this->ClearLastSelection();
+                    gpx::MaxFlowResult result = gpx::MaxFlow(this->view->GetGraph(), this->maxFlowSource, this->maxFlowSink);
+                    this->maxFlowValue = result.value;
+
+                    for (usize i = 0; i < result.flows.size(); ++i) {
+                        if(result.flows[i] != 0) {
+                            this->renderer.UpdateEdgeColor(i, Rgba8(0x0000FFFF));
+                        }
+                    }
+
+                    for (const usize edgeId : result.minCut) {
+                        this->renderer.UpdateEdgeColor(edgeId, Rgba8(0xFF0000FF));
+                    }
+                }
+
+                nk_labelf(ctx, NK_TEXT_LEFT, "Flow: %.2f", this->maxFlowValue);
+                nk_tree_pop(ctx);
+            }
+
+            if(nk_tree_push(ctx, NK_TREE_TAB, "Centrality", NK_MINIMIZED)) {
+                nk_label_wrap(ctx, "Colors every vertex from blue (least central) to red (most central)");
+
+                if(nk_button_label(ctx, "PageRank")) {
+                    this->ClearLastSelection();
+                    this->ColorVertexScores(gpx::PageRank(this->view->GetGraph()).scores);
+                }
+
+                if(nk_button_label(ctx, "Eigenvector")) {
+                    this->ClearLastSelection();
+                    this->ColorVertexScores(gpx::EigenvectorCentrality(this->view->GetGraph()).scores);
+                }
+
+                if(nk_button_label(ctx, "Katz")) {
+                    this->ClearLastSelection();
+                    this->ColorVertexScores(gpx::KatzCentrality(this->view->GetGraph(), gpx::KatzAlphaFor(this->view->GetGraph())).scores);
+                }
+
+                if(nk_button_label(ctx, "Betweenness")) {
+                    this->ClearLastSelection();
+
+                    // Exact for small graphs, sampled within ~5% otherwise so the UI doesn't freeze
+                    gpx::BetweennessOptions options{};
+                    options.samples = gpx::BetweennessSamplesFor(this->view->GetGraph().Vertices(), 0.05);
+                    this->ColorVertexScores(gpx::Betweenness(this->view->GetGraph(), options).vertices);
+                }
+
+                nk_tree_pop(ctx);
+            }
+
+            if(nk_tree_push(ctx, NK_TREE_TAB, "Coloring", NK_MINIMIZED)) {
+                std::optional<gpx::ColoringResult> coloring;
+
+                if(nk_button_label(ctx, "Greedy (Largest First)")) {
+                    coloring = gpx::GreedyColoring(this->view->GetGraph(), gpx::ColoringOrder::LargestFirst);
+                }
+
+                if(nk_button_label(ctx, "Greedy (Smallest Last)")) {
+                    coloring = gpx::GreedyColoring(this->view->GetGraph(), gpx::ColoringOrder::SmallestLast);
+                }
+
+                if(nk_button_label(ctx, "DSatur")) {
+                    coloring = gpx::DSaturColoring(this->view->GetGraph());
+                }
+
+                if(nk_button_label(ctx, "Jones-Plassmann")) {
+                    coloring = gpx::JonesPlassmannColoring(this->view->GetGraph(), sapp_frame_count());
+                }
+
+                if(coloring) {
+                    this->ClearLastSelection();
+                    this->ColorVertexClasses(coloring->colors);
+                    this->coloringColors = coloring->colorCount;
+                }
+
+                nk_labelf(ctx, NK_TEXT_LEFT, "Colors used: %zu", this->coloringColors);
+                nk_tree_pop(ctx);
+            }
+
+            if(nk_tree_push(ctx, NK_TREE_TAB, "Matching", NK_MINIMIZED)) {
+                if(nk_button_label(ctx, "Bipartition")) {
+                    this->ClearLastSelection();
+                    gpx::BipartitionResult bipartition = gpx::Bipartition(this->view->GetGraph());
+
+                    if(bipartition.bipartite) {
+                        this->ColorVertexClasses(std::vector<usize>(bipartition.sides.begin(), bipartition.sides.end()));
+                    }
+
+                    for (const usize edgeId : bipartition.oddCycle) {
+                        this->renderer.UpdateEdgeColor(edgeId, Rgba8(0xFF0000FF));
+                    }
+                }
+
+                if(nk_button_label(ctx, "Maximum Matching")) {
+                    this->ClearLastSelection();
+
+                    if(std::optional<std::vector<usize>> matching = gpx::HopcroftKarp(this->view->GetGraph())) {
+                        for (const usize edgeId : *matching) {
+                            const gpx::Edge& edge = this->view->GetGraph().Edges()[edgeId];
+                            this->renderer.UpdateVertexColor(edge.fromId, Rgba8(0x0000FFFF));
+                            this->renderer.UpdateVertexColor(edge.toId, Rgba8(0x0000FFFF));
+                            this->renderer.UpdateEdgeColor(edgeId, Rgba8(0x0000FFFF));
+                        }
+                    }
+                }
+
+                nk_tree_pop(ctx);
+            }
+
+            if(nk_tree_push(ctx, NK_TREE_TAB, "Topological Order", NK_MINIMIZED)) {
+                nk_label_wrap(ctx, "Edges always go from their first to their second vertex");
+
+                if(nk_button_label(ctx, "Wavefronts")) {
+                    this->ClearLastSelection();
+                    gpx::TopologicalLevels levels = gpx::TopologicalWavefronts(this->view->GetGraph());
+
+                    if(levels.acyclic) {
+                        std::vector<f64> vertexLevels(this->view->GetGraph().Vertices());
+
+                        for (usize level = 0; level < levels.Levels(); ++level) {
+                            for (usize i = levels.levelOffsets[level]; i < levels.levelOffsets[level + 1]; ++i) {
+                                vertexLevels[levels.vertices[i]] = level;
+                            }
+                        }
+
+                        this->ColorVertexScores(vertexLevels);
+                    }
+
+                    for (const usize edgeId : levels.cycle) {
+                        this->renderer.UpdateEdgeColor(edgeId, Rgba8(0xFF0000FF));
+                    }
+                }
+
+                nk_tree_pop(ctx);
+            }
+
+            if(nk_tree_push(ctx, NK_TREE_TAB, "Eulerian Path", NK_MINIMIZED)) {
+                if(nk_button_label(ctx, "Find")) {
+                    this->ClearLastSelection();
+                    gpx::EulerianResult eulerian = gpx::EulerianPath(this->view->GetGraph());
+                    this->eulerianStatus = !eulerian.exists ? "No Eulerian path" : eulerian.circuit ? "Eulerian circuit" : "Eulerian path";
+
+                    for (const usize edgeId : eulerian.edges) {
+                        this->renderer.UpdateEdgeColor(edgeId, Rgba8(0x0000FFFF));
+                    }
+
+                    if(!eulerian.vertices.empty()) {
+                        this->renderer.UpdateVertexColor(eulerian.vertices.front(), Rgba8(0xFF0000FF));
+                    }
+                }
+
+                nk_label(ctx, this->eulerianStatus, NK_TEXT_LEFT);
+                nk_tree_pop(ctx);
+            }
+
             nk_tree_pop(ctx);
         }
     }
@@ -247,10 +634,14 @@ void Graphexia::Update(f32 dt, nk_context* ctx) {
     if(nk_begin(ctx, "Graph Info", nk_rect(10, 10, 160, 150), NK_WINDOW_BORDER | NK_WINDOW_MOVABLE | NK_WINDOW_MINIMIZABLE)) {
         nk_layout_row_dynamic(ctx, 16, 1);
         
-        nk_labelf(ctx, NK_TEXT_LEFT, "Vertices: %zu", graph.Vertices()); 
-        nk_labelf(ctx, NK_TEXT_LEFT, "Edges: %zu", graph.Edges().size());
-        if(nk_button_label(ctx, graph.IsDirected() ? "Directed" : "Undirected")) {
-            this->view.SetDirected(!graph.IsDirected());
+        nk_labelf(ctx, NK_TEXT_LEFT, "Vertices: %zu", this->view->GetGraph().Vertices()); 
+        nk_labelf(ctx, NK_TEXT_LEFT, "Edges: %zu", this->view->GetGraph().Edges().size());
+        if(nk_button_label(ctx, this->view->GetGraph().IsDirected() ? "Directed" : "Undirected")) {
+            bool directed = !this->view->GetGraph().IsDirected();
+
+            this->ResetSteppedState();
+            this->EditView().SetDirected(directed);
+            this->journal.SetDirected(directed);
         }
     }
     nk_end(ctx);
@@ -262,25 +653,37 @@ void Graphexia::Update(f32 dt, nk_context* ctx) {
                 if(this->selectedId != GraphView::NoId) {
                     nk_label(ctx, "Vertex", NK_TEXT_LEFT);
                     nk_labelf(ctx, NK_TEXT_LEFT, "ID: %zu", this->selectedId);
-                    nk_labelf(ctx, NK_TEXT_LEFT, "Degree: %zu", graph.EdgesForVertex(this->selectedId).size());
-
-                    Vertex& view = this->view.View(this->selectedId);
-                    i32 labelSize = view.labelSize;
-
-                    nk_edit_string(ctx, NK_EDIT_FIELD, view.label.data(), &labelSize, Vertex::MaxLabelLength, nk_filter_default);
-                    view.labelSize = labelSize;
+                    nk_labelf(ctx, NK_TEXT_LEFT, "Degree: %zu", this->view->GetGraph().EdgesForVertex(this->selectedId).size());
+
+                    const Vertex& vertex = this->view->Vertices()[this->selectedId];
+                    i32 labelSize = vertex.labelSize;
+                    std::array<char, Vertex::MaxLabelLength> label = vertex.label;
+
+                    nk_edit_string(ctx, NK_EDIT_FIELD, label.data(), &labelSize, Vertex::MaxLabelLength, nk_filter_default);
+                    if(labelSize != vertex.labelSize || label != vertex.label) {
+                        Vertex& edited = this->EditView().View(this->selectedId);
+                        edited.labelSize = labelSize;
+                        edited.label = label;
+                        this->journal.VertexLabel(this->selectedId, std::string_view(edited.label.data(), edited.labelSize));
+                    }
                 }
                 break;
             }
             case GraphexiaMode::EditEdges: { 
                 if(this->selectedId != GraphView::NoId) {
                     if((this->selectionType & SelectionType::EdgeSelected) == SelectionType::EdgeSelected) {
-                        const gpx::Edge& edge = graph.Edges()[this->selectedId];
-                        f32& edgeWeight = this->view.EdgeWeight(this->selectedId); 
+                        const gpx::Edge& edge = this->view->GetGraph().Edges()[this->selectedId];
+                        f32 edgeWeight = edge.weight;
 
                         nk_label(ctx, "Edge", NK_TEXT_LEFT);
                         nk_labelf(ctx, NK_TEXT_LEFT, "%zu -> %zu", edge.fromId, edge.toId);
                         nk_property_float(ctx, "Weight", 0, &edgeWeight, std::numeric_limits<f32>::infinity(), 1.f, .1f);
+
+                        if(edgeWeight != edge.weight) {
+                            this->ResetSteppedState();
+                            this->EditView().EdgeWeight(this->selectedId) = edgeWeight;
+                            this->journal.EdgeWeight(this->selectedId, edgeWeight);
+                        }
                     } else if((this->selectionType & SelectionType::VertexSelected) == SelectionType::VertexSelected) {
                         nk_label(ctx, "Creating edge", NK_TEXT_LEFT);
                         nk_labelf(ctx, NK_TEXT_LEFT, "From ID: %zu", this->selectedId);
@@ -292,6 +695,9 @@ void Graphexia::Update(f32 dt, nk_context* ctx) {
     }
     nk_end(ctx);
 
+    this->UpdateLayout();
+    this->Autosave(dt);
+
     this->renderer.SetViewport({static_cast<u32>(sapp_width()), static_cast<u32>(sapp_height())});
     this->renderer.Update(dt);
 }
@@ -320,12 +726,12 @@ void Graphexia::Event(const sapp_event* event) {
             switch (event->mouse_button) {
                 case SAPP_MOUSEBUTTON_LEFT: {
                     f32x2 worldPosition = this->renderer.ScreenToWorld({event->mouse_x, event->mouse_y});
-                    usize newSelection = this->view.FindVertex(worldPosition, this->selectedId);
+                    usize newSelection = this->view->FindVertex(worldPosition, this->selectedId);
 
                     switch (this->mode) {
                         case GraphexiaMode::EditVertices: {
                             if(newSelection == GraphView::NoId) {
-                                newSelection = this->view.FindVertex(worldPosition);
+                                newSelection = this->view->FindVertex(worldPosition);
 
                                 if(this->selectedId == newSelection && newSelection == GraphView::NoId) {
                                     this->AddVertex(worldPosition);
@@ -335,7 +741,7 @@ void Graphexia::Event(const sapp_event* event) {
                             this->Select(SelectionType::VertexSelected, newSelection);
 
                             if(this->selectedId != GraphView::NoId) {
-                                const Vertex& vertex = this->view.Vertices()[this->selectedId];
+                                const Vertex& vertex = this->view->Vertices()[this->selectedId];
                                 this->selectedVertexMouseOffset = { vertex.position.x - worldPosition.x, vertex.position.y - worldPosition.y };
                                 this->currentlyDraggingVertex = true;
                             }
@@ -344,10 +750,10 @@ void Graphexia::Event(const sapp_event* event) {
                         }
                         case GraphexiaMode::EditEdges: {
                             if(newSelection == GraphView::NoId) {
-                                newSelection = this->view.FindVertex(worldPosition);
+                                newSelection = this->view->FindVertex(worldPosition);
 
                                 if(newSelection == GraphView::NoId) {
-                                    newSelection = this->view.FindEdge(worldPosition);
+                                    newSelection = this->view->FindEdge(worldPosition);
 
                                     this->Select(SelectionType::EdgeSelected, newSelection);
                                     break;
@@ -372,7 +778,7 @@ void Graphexia::Event(const sapp_event* event) {
                     switch (this->mode) {
                         case GraphexiaMode::EditVertices: {
                             if((this->selectionType & SelectionType::VertexSelected) == SelectionType::VertexSelected && this->selectedId != GraphView::NoId) {
-                                const Vertex& vView = this->view.Vertices()[this->selectedId];
+                                const Vertex& vView = this->view->Vertices()[this->selectedId];
                                 
                                 if(vView.Collides(worldPosition)) {
                                     if((this->selectionType & SelectionType::DeletionRequest) != SelectionType::DeletionRequest) {
@@ -391,7 +797,7 @@ void Graphexia::Event(const sapp_event* event) {
                                 break;
                             }
                             
-                            usize selectedEdge = this->view.FindEdge(worldPosition);
+                            usize selectedEdge = this->view->FindEdge(worldPosition);
                             
                             if(this->selectedId == selectedEdge && this->selectedId != GraphView::NoId) {
                                 if((this->selectionType & SelectionType::DeletionRequest) != SelectionType::DeletionRequest) {
@@ -417,6 +823,11 @@ void Graphexia::Event(const sapp_event* event) {
                 case SAPP_MOUSEBUTTON_LEFT: {
                     switch (this->mode) {
                         case GraphexiaMode::EditVertices: {
+                            // Only where the drag ended is journaled, not every step of it
+                            if(this->currentlyDraggingVertex && this->selectedId != GraphView::NoId) {
+                                this->journal.MoveVertex(this->selectedId, this->view->Vertices()[this->selectedId].position);
+                            }
+
                             this->currentlyDraggingVertex = false;
                             break;
                         }
@@ -443,7 +854,7 @@ void Graphexia::Event(const sapp_event* event) {
                 case GraphexiaMode::EditVertices: {
                     if(this->currentlyDraggingVertex) {
                         f32x2 newPosition = {(this->currentMouseWorldPosition.x + this->selectedVertexMouseOffset.x), (this->currentMouseWorldPosition.y + this->selectedVertexMouseOffset.y)};
-                        this->view.MoveVertex(this->selectedId, newPosition); 
+                        this->EditView().MoveVertex(this->selectedId, newPosition); 
                         this->renderer.UpdateVertexPosition(this->selectedId, newPosition);
                     }
                     break;
@@ -457,31 +868,81 @@ void Graphexia::Event(const sapp_event* event) {
 }
 
 void Graphexia::AddVertex(f32x2 position) {
-    this->view.AddVertex(position);
-    this->renderer.AddVertex(this->view.Vertices().back());
+    this->StopLayout();
+    this->ResetSteppedState();
+    this->EditView().AddVertex(position);
+    this->journal.AddVertex(position);
+    this->renderer.AddVertex(this->view->Vertices().back());
 }
 
 void Graphexia::AddEdge(usize from, usize to) {
-    this->view.AddEdge(from, to); 
-    this->renderer.AddEdge(this->view.GetGraph().Edges().back());
+    this->StopLayout();
+    this->ResetSteppedState();
+    this->EditView().AddEdge(from, to); 
+    this->journal.AddEdge(from, to, 0);
+    this->renderer.AddEdge(this->view->GetGraph().Edges().back());
 }
 
 void Graphexia::EraseVertex(usize id) {
-    this->view.EraseVertex(id);
+    this->StopLayout();
+    this->ResetSteppedState();
+    this->EditView().EraseVertex(id);
+    this->journal.EraseVertex(id);
     this->renderer.EraseVertex(id);
-    this->renderer.ReconstructEdges(this->view.GetGraph().Edges());
+    this->renderer.ReconstructEdges(this->view->GetGraph().Edges());
     this->selectionType = SelectionType::None;
     this->selectedId = GraphView::NoId;
     this->currentlyDraggingVertex = false;
 }
 
 void Graphexia::EraseEdge(usize id) {
-    this->view.EraseEdge(id);
+    this->StopLayout();
+    this->ResetSteppedState();
+    this->EditView().EraseEdge(id);
+    this->journal.EraseEdge(id);
     this->renderer.EraseEdge(id);
     this->selectionType = SelectionType::None;
     this->selectedId = GraphView::NoId;
 }
 
+void Graphexia::ColorVertexScores(const std::vector<f64>& scores) {
+    // A diverged centrality (or anything else) leaves the colors as they are, a NaN can't be turned into a color
+    if(scores.empty() || !std::all_of(scores.begin(), scores.end(), [](f64 score) { return std::isfinite(score); })) {
+        return;
+    }
+
+    auto [minimum, maximum] = std::minmax_element(scores.begin(), scores.end());
+    f64 range = *maximum - *minimum;
+
+    for (usize i = 0; i < scores.size(); ++i) {
+        f32 t = range > 0 ? static_cast<f32>((scores[i] - *minimum) / range) : 0.f;
+        u32 red = static_cast<u32>(t * 255.f);
+
+        this->renderer.UpdateVertexColor(i, Rgba8((red << 24) | ((255 - red) << 8) | 0xFF));
+    }
+}
+
+void Graphexia::ColorVertexClasses(const std::vector<usize>& classes) {
+    static constexpr u32 Palette[] = {
+        0xE6194BFF, 0x3CB44BFF, 0xFFE119FF, 0x4363D8FF, 0xF58231FF, 0x911EB4FF,
+        0x46F0F0FF, 0xF032E6FF, 0xBCF60CFF, 0xFABEBEFF, 0x008080FF, 0xE6BEFFFF,
+    };
+    constexpr usize PaletteSize = sizeof(Palette) / sizeof(*Palette);
+
+    for (usize i = 0; i < classes.size(); ++i) {
+        usize colorClass = classes[i];
+
+        if(colorClass < PaletteSize) {
+            this->renderer.UpdateVertexColor(i, Rgba8(Palette[colorClass]));
+            continue;
+        }
+
+        // Ran out of palette, scramble the class into some color
+        u32 hashed = static_cast<u32>(colorClass * 0x9E3779B1u);
+        this->renderer.UpdateVertexColor(i, Rgba8(hashed | 0xFF));
+    }
+}
+
 void Graphexia::Select(const SelectionType type, const usize id) {
     this->ClearLastSelection();
     this->selectionType = type;
@@ -519,6 +980,66 @@ void Graphexia::ClearLastSelection() {
     }
 }
 
+void Graphexia::ExportView(ExportFormat format) {
+    if(this->exportPathLength == 0) {
+        this->exportStatus = "Write a path first";
+        return;
+    }
+
+    // Only one export at a time, the previous one may be writing to the same file
+    if(this->exporting) {
+        this->exportStatus = "Still exporting...";
+        return;
+    }
+
+    // The worker shares the view instead of copying it, an edit while it's still writing copies it first (see EditView)
+    this->exporting = true;
+    this->exportedView = this->view.get();
+    this->exportStatus = "Exporting...";
+
+    auto exportSnapshot = [this, format, path = std::string(this->exportPath, this->exportPathLength), snapshot = std::shared_ptr<const GraphView>(this->view)]() {
+        GraphViewAttributes attributes = snapshot->Attributes();
+        std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+
+        bool exported = false;
+        if(stream) {
+            switch(format) {
+                case ExportFormat::DOT: exported = gpx::ExportDOT(stream, snapshot->GetGraph(), attributes.View()); break;
+                case ExportFormat::GraphML: exported = gpx::ExportGraphML(stream, snapshot->GetGraph(), attributes.View()); break;
+                case ExportFormat::EdgeList: exported = gpx::ExportEdgeList(stream, snapshot->GetGraph()); break;
+            }
+        }
+
+        this->exportStatus = exported ? "Exported" : "Export failed";
+        // Nothing reads the snapshot after this
+        this->exporting.store(false, std::memory_order_release);
+    };
+
+#ifdef GRAPHEXIA_NO_THREADS
+    exportSnapshot();
+#else
+    // Already done, joining doesn't wait
+    if(this->exportWorker.joinable()) {
+        this->exportWorker.join();
+    }
+
+    this->exportWorker = std::jthread(std::move(exportSnapshot));
+#endif
+}
+
+bool Graphexia::ViewExported() const {
+    return this->exporting.load(std::memory_order_acquire) && this->exportedView == this->view.get();
+}
+
+GraphView& Graphexia::EditView() {
+    // Copy on write, at most once per export: the copy is not the exported view anymore
+    if(this->ViewExported()) {
+        this->view = std::make_shared<GraphView>(*this->view);
+    }
+
+    return *this->view;
+}
+
 void Graphexia::ChangeMode(const GraphexiaMode mode) {
     if(this->mode == mode)
         return;
@@ -528,3 +1049,193 @@ void Graphexia::ChangeMode(const GraphexiaMode mode) {
     this->selectionType = SelectionType::None;
     this->selectedId = GraphView::NoId;
 }
+
+void Graphexia::ReplaceView(GraphView&& view) {
+    this->StopLayout();
+    this->ResetSteppedState();
+    // The export keeps the old one
+    if(this->ViewExported()) {
+        this->view = std::make_shared<GraphView>(std::move(view));
+    } else {
+        *this->view = std::move(view);
+    }
+
+    this->renderer.ReconstructView(*this->view);
+    this->selectionType = SelectionType::None;
+    this->selectedId = GraphView::NoId;
+
+    this->journal.Clear();
+    this->workspaceNeedsSnapshot = true;
+}
+
+void Graphexia::UpdateLayout() {
+    if(!this->layoutWorker) {
+        return;
+    }
+
+    const LayoutWorker::Snapshot* snapshot = this->layoutWorker->Acquire();
+    if(!snapshot) {
+        return;
+    }
+
+    this->EditView().MoveVertices(snapshot->x, snapshot->y);
+    this->renderer.UpdateVertexPositions(snapshot->x, snapshot->y);
+
+    if(snapshot->settled) {
+        this->StopLayout();
+    }
+}
+
+void Graphexia::StopLayout() {
+    if(!this->layoutWorker) {
+        return;
+    }
+
+    // Moving every vertex doesn't fit in the journal
+    this->layoutWorker.reset();
+    this->workspaceNeedsSnapshot = true;
+}
+
+void Graphexia::ResetSteppedState() {
+    // Its residual network was built from the old edges and capacities
+    this->maxFlowState = gpx::MaxFlowState();
+}
+
+// Appending is cheap, a snapshot costs the whole graph so it waits until the journal is worth compacting
+static constexpr f32 AutosaveInterval = 5.f;
+static constexpr u64 MinimumCompactionBytes = 1 << 20;
+
+void Graphexia::Autosave(f32 dt) {
+    if(this->workspaceFile.empty() || this->workspaceSaving) {
+        return;
+    }
+
+    this->autosaveElapsed += dt;
+    if(this->autosaveElapsed < AutosaveInterval) {
+        return;
+    }
+
+    this->autosaveElapsed = 0;
+
+    u64 journalSize = this->journalBytes + this->journal.Records().size();
+    if(this->workspaceNeedsSnapshot || journalSize > std::max<u64>(this->snapshotBytes / 4, MinimumCompactionBytes)) {
+        this->SaveWorkspaceSnapshot();
+        return;
+    }
+
+    if(this->journal.Empty()) {
+        return;
+    }
+
+    if(!AppendWorkspaceJournal(this->workspaceFile, this->journal.Records())) {
+        this->workspaceStatus = "Autosave failed";
+        return;
+    }
+
+    this->journalBytes = journalSize;
+    this->journal.Clear();
+}
+
+void Graphexia::SaveWorkspaceSnapshot() {
+    if(this->workspaceSaving) {
+        this->workspaceStatus = "Still saving...";
+        return;
+    }
+
+    const std::vector<Vertex>& vertices = this->view->Vertices();
+    const std::vector<gpx::Edge>& edges = this->view->GetGraph().Edges();
+
+    WorkspaceState state{*this->view, std::vector<u32>(vertices.size()), std::vector<u32>(edges.size())};
+    for (usize i = 0; i < vertices.size(); ++i) {
+        state.vertexColors[i] = Rgba8Value(this->renderer.VertexColor(i));
+    }
+
+    for (usize i = 0; i < edges.size(); ++i) {
+        state.edgeColors[i] = Rgba8Value(this->renderer.EdgeColor(i));
+    }
+
+    // The selection highlight isn't part of the workspace
+    if(this->selectedId != GraphView::NoId) {
+        if((this->selectionType & SelectionType::EdgeSelected) == SelectionType::EdgeSelected) {
+            state.edgeColors[this->selectedId] = 0xFFFFFFFF;
+        } else if((this->selectionType & SelectionType::VertexSelected) == SelectionType::VertexSelected) {
+            state.vertexColors[this->selectedId] = 0xFFFFFFFF;
+        }
+    }
+
+    // Everything journaled until now is in the snapshot
+    this->journal.Clear();
+    this->journalBytes = 0;
+    this->workspaceNeedsSnapshot = false;
+    this->workspaceSaving = true;
+    this->workspaceStatus = "Saving...";
+
+    auto saveSnapshot = [this, path = this->workspaceFile, state = std::move(state)]() {
+        bool saved = SaveWorkspace(path, state);
+
+        std::error_code error;
+        u64 size = std::filesystem::file_size(path, error);
+        this->snapshotBytes = error ? 0 : size;
+
+        // Records made after the copy aren't in the old journal anymore, only a new snapshot can keep them
+        if(!saved) {
+            this->workspaceNeedsSnapshot = true;
+        }
+
+        this->workspaceStatus = saved ? "Saved" : "Save failed";
+        this->workspaceSaving = false;
+    };
+
+#ifdef GRAPHEXIA_NO_THREADS
+    saveSnapshot();
+#else
+    if(this->workspaceWorker.joinable()) {
+        this->workspaceWorker.join();
+    }
+
+    this->workspaceWorker = std::jthread(std::move(saveSnapshot));
+#endif
+}
+
+void Graphexia::LoadWorkspaceFile() {
+    if(this->workspacePathLength == 0) {
+        this->workspaceStatus = "Write a path first";
+        return;
+    }
+
+#ifndef GRAPHEXIA_NO_THREADS
+    // It may be writing the very file we're about to read
+    if(this->workspaceWorker.joinable()) {
+        this->workspaceWorker.join();
+    }
+#endif
+
+    std::filesystem::path path(std::string(this->workspacePath, this->workspacePathLength));
+    std::optional<WorkspaceState> state = LoadWorkspace(path);
+
+    if(!state) {
+        this->workspaceStatus = "Load failed";
+        return;
+    }
+
+    this->ReplaceView(std::move(state->view));
+
+    for (usize i = 0; i < state->vertexColors.size(); ++i) {
+        this->renderer.UpdateVertexColor(i, Rgba8(state->vertexColors[i]));
+    }
+
+    for (usize i = 0; i < state->edgeColors.size(); ++i) {
+        this->renderer.UpdateEdgeColor(i, Rgba8(state->edgeColors[i]));
+    }
+
+    std::error_code journalError, snapshotError;
+    u64 journalSize = std::filesystem::file_size(WorkspaceJournalPath(path), journalError);
+    u64 snapshotSize = std::filesystem::file_size(path, snapshotError);
+
+    this->workspaceFile = path;
+    this->workspaceNeedsSnapshot = false;
+    this->journalBytes = journalError ? 0 : journalSize;
+    this->snapshotBytes = snapshotError ? 0 : snapshotSize;
+    this->autosaveElapsed = 0;
+    this->workspaceStatus = "Loaded";
+}
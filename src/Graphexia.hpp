@@ -4,18 +4,29 @@
 #include "Core.hpp"
 #include "GraphView.hpp"
 #include "GPXRenderer.hpp"
+#include "LayoutWorker.hpp"
+#include "Workspace.hpp"
 
 #include <Graphexia/Algo/Kruskal.hpp>
 #include <Graphexia/Algo/BFS.hpp>
 #include <Graphexia/Algo/DFS.hpp>
+#include <Graphexia/Algo/MaxFlow.hpp>
+#include <Graphexia/Parallel.hpp>
 
 #include <sokol/sokol_app.h>
 #include <nuklear/nuklear.h>
 
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <thread>
+
 
 class Graphexia final {
 public:
     Graphexia(); 
+    ~Graphexia();
     
     void Init();
     void Update(f32 dt, nk_context* ctx);
@@ -34,7 +45,37 @@ private:
 
     void ChangeMode(GraphexiaMode mode);
 
-    GraphView view;
+    // Anything that swaps the whole view (generators, reset...) goes through here, the journal can't express it
+    void ReplaceView(GraphView&& view);
+
+    // Picks up the latest positions published by the layout worker, if any
+    void UpdateLayout();
+    // The layout works on a copy of the graph, so any edit ends it
+    void StopLayout();
+    // Stepped algorithms whose state can't follow an edit start over
+    void ResetSteppedState();
+
+    // Appends the pending journal records every AutosaveInterval seconds, or compacts them into a new snapshot
+    // once the journal is a fair fraction of it
+    void Autosave(f32 dt);
+    // Writes the whole workspace to workspaceFile in a worker thread, edits meanwhile wait in the journal
+    void SaveWorkspaceSnapshot();
+    void LoadWorkspaceFile();
+
+    // Writes the view to exportPath in a worker thread, the UI keeps running meanwhile. Refused while another export runs.
+    void ExportView(ExportFormat format);
+    // Whether the running export still reads the current view
+    bool ViewExported() const;
+    // Every edit of the view goes through here, so an export reading it keeps its own unchanged one
+    GraphView& EditView();
+
+    // Maps every score linearly between the minimum and maximum to a blue -> red gradient
+    void ColorVertexScores(const std::vector<f64>& scores);
+    // Gives every class (e.g. a vertex coloring) its own palette color
+    void ColorVertexClasses(const std::vector<usize>& classes);
+
+    // Shared with the running export (if any), see EditView
+    std::shared_ptr<GraphView> view;
     GPXRenderer renderer;
 
     GraphexiaMode mode;
@@ -52,13 +93,62 @@ private:
     i32 savedHavelHakimiSequenceLength;
     char savedHavelHakimiSequence[256];
     bool renderHakimiRandom;
+    nk_bool hakimiRandomRealization;
     std::vector<usize> havelHakimiSequence;
 
+    i32 randomGraphKind;
+    i32 randomGraphVertices;
+    // Parameters of every generator, kept apart so switching between them doesn't carry a value over
+    f32 gnpProbability;
+    i32 gnmEdges;
+    i32 barabasiAlbertEdges;
+    i32 wattsStrogatzNeighbours;
+    f32 wattsStrogatzRewiring;
+    i32 rmatEdges;
+    i32 gridWidth;
+
     gpx::KruskalState kruskalState;
 
     i32 initialVertex, endVertex;
     gpx::BFSState bfsState;
     gpx::DFSState dfsState;
+
+    usize coloringColors;
+
+    // Not shared with BFS / DFS, whose 'To' can be -1 (no target)
+    i32 maxFlowSource, maxFlowSink;
+    gpx::MaxFlowState maxFlowState;
+    f64 maxFlowValue;
+
+    const char* eulerianStatus;
+
+    i32 layoutModel;
+    std::optional<LayoutWorker> layoutWorker;
+
+    char exportPath[256];
+    i32 exportPathLength;
+    std::atomic<const char*> exportStatus;
+    std::atomic<bool> exporting;
+    // View the running export reads
+    const GraphView* exportedView;
+#ifndef GRAPHEXIA_NO_THREADS
+    std::jthread exportWorker;
+#endif
+
+    char workspacePath[256];
+    i32 workspacePathLength;
+    // Workspace being autosaved, empty until one is saved or loaded
+    std::filesystem::path workspaceFile;
+    WorkspaceJournal journal;
+    f32 autosaveElapsed;
+    u64 journalBytes;
+    std::atomic<u64> snapshotBytes;
+    std::atomic<bool> workspaceNeedsSnapshot;
+    std::atomic<bool> workspaceSaving;
+    std::atomic<const char*> workspaceStatus;
+#ifndef GRAPHEXIA_NO_THREADS
+    std::jthread workspaceWorker;
+#endif
 };
 
 #endif
@@ -0,0 +1,97 @@
+#include "LayoutWorker.hpp"
+
+LayoutWorker::LayoutWorker(Setup setup)
+    : setup(std::move(setup)), state(), buffers(), back(0), front(1), middle(2), settled() {
+    this->Start();
+}
+
+void LayoutWorker::Start() {
+#ifndef GRAPHEXIA_NO_THREADS
+    this->worker = std::jthread([this](std::stop_token stop) {
+        while(!stop.stop_requested()) {
+            bool settled = this->Step(stop);
+            // A stopped setup may have left a partial state behind
+            if(stop.stop_requested()) {
+                break;
+            }
+
+            this->Publish(settled);
+
+            if(settled) {
+                break;
+            }
+        }
+    });
+#endif
+}
+
+const LayoutWorker::Snapshot* LayoutWorker::Acquire() {
+#ifdef GRAPHEXIA_NO_THREADS
+    if(!this->settled) {
+        this->settled = this->Step(std::stop_token());
+        this->Publish(this->settled);
+    }
+#endif
+
+    if(!(this->middle.load(std::memory_order_acquire) & FreshSnapshot)) {
+        return nullptr;
+    }
+
+    this->front = this->middle.exchange(this->front, std::memory_order_acq_rel) & BufferIndex;
+    return &this->buffers[this->front];
+}
+
+bool LayoutWorker::Step(std::stop_token stop) {
+    if(this->setup) {
+        this->state = this->setup(stop);
+        this->setup = nullptr;
+        return false;
+    }
+
+    if(gpx::ForceLayoutState* force = std::get_if<gpx::ForceLayoutState>(&this->state)) {
+        return gpx::IterateForceLayout(*force);
+    }
+
+    if(gpx::MultilevelLayoutState* multilevel = std::get_if<gpx::MultilevelLayoutState>(&this->state)) {
+        return gpx::IterateMultilevelLayout(*multilevel);
+    }
+
+    return gpx::IterateStressLayout(std::get<gpx::StressLayoutState>(this->state));
+}
+
+void LayoutWorker::Publish(bool settled) {
+    // The UI still hasn't taken the previous snapshot, copying another one would only slow the layout down
+    if(!settled && (this->middle.load(std::memory_order_acquire) & FreshSnapshot)) {
+        return;
+    }
+
+    Snapshot& snapshot = this->buffers[this->back];
+    snapshot.settled = settled;
+
+    if(const gpx::ForceLayoutState* force = std::get_if<gpx::ForceLayoutState>(&this->state)) {
+        snapshot.x.assign(force->x.begin(), force->x.end());
+        snapshot.y.assign(force->y.begin(), force->y.end());
+        snapshot.iteration = force->iteration;
+        snapshot.level = 0;
+        snapshot.displacement = force->displacement;
+    } else if(const gpx::MultilevelLayoutState* multilevel = std::get_if<gpx::MultilevelLayoutState>(&this->state)) {
+        usize vertices = multilevel->hierarchy.Levels() != 0 ? multilevel->hierarchy.Level(0).csr.Vertices() : 0;
+
+        snapshot.x.resize(vertices);
+        snapshot.y.resize(vertices);
+        gpx::MultilevelLayoutPositions(*multilevel, snapshot.x, snapshot.y);
+        snapshot.iteration = multilevel->force.iteration;
+        snapshot.level = multilevel->level;
+        snapshot.displacement = multilevel->force.displacement;
+    } else {
+        const gpx::StressLayoutState& stress = std::get<gpx::StressLayoutState>(this->state);
+
+        snapshot.x.assign(stress.x.begin(), stress.x.end());
+        snapshot.y.assign(stress.y.begin(), stress.y.end());
+        snapshot.iteration = stress.iteration;
+        snapshot.level = 0;
+        snapshot.displacement = stress.displacement;
+    }
+
+    this->back = this->middle.exchange(this->back | FreshSnapshot, std::memory_order_acq_rel) & BufferIndex;
+}
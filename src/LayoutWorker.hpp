@@ -0,0 +1,77 @@
+#ifndef _GRAPHEXIA_APP_LAYOUTWORKER__HPP_
+#define _GRAPHEXIA_APP_LAYOUTWORKER__HPP_
+
+#include "Core.hpp"
+
+#include <Graphexia/Layout/ForceLayout.hpp>
+#include <Graphexia/Layout/MultilevelLayout.hpp>
+#include <Graphexia/Layout/StressLayout.hpp>
+#include <Graphexia/Parallel.hpp>
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <stop_token>
+#include <thread>
+#include <variant>
+#include <vector>
+
+// Iterates a layout in a worker thread so a large graph can settle without blocking the UI. Positions are published through
+// a triple buffer: the worker writes one buffer, the UI reads another and the third holds the latest snapshot. Publishing and
+// acquiring swap a buffer with that third one, so neither side ever waits for the other and the UI always sees whole iterations.
+//
+// Destroying it waits for the current iteration (or the setup to notice it was stopped).
+// Without threads the iterations run in Acquire instead, one per frame.
+class LayoutWorker final {
+public:
+    struct Snapshot {
+        std::vector<f32> x, y;
+        usize iteration;
+        // Level of the coarsening hierarchy being laid out, 0 for flat layouts
+        usize level;
+        f32 displacement;
+        bool settled;
+    };
+
+    using State = std::variant<gpx::ForceLayoutState, gpx::MultilevelLayoutState, gpx::StressLayoutState>;
+
+    // 'setup' runs in the worker too, building the state of a large graph (a coarsening hierarchy, Pivot MDS...) takes a while.
+    // It gets the stop token of the worker and should hand it to the setup options, so destroying the worker doesn't wait for it.
+    using Setup = std::function<State(std::stop_token)>;
+
+    explicit LayoutWorker(Setup setup);
+
+    // The worker thread points to this
+    LayoutWorker(const LayoutWorker&) = delete;
+    LayoutWorker& operator=(const LayoutWorker&) = delete;
+
+    // Latest snapshot published since the previous call or nullptr if there's none, valid until the next call
+    const Snapshot* Acquire();
+    // Last acquired snapshot
+    const Snapshot& Current() const { return this->buffers[this->front]; }
+private:
+    static constexpr u8 FreshSnapshot = 0x4;
+    static constexpr u8 BufferIndex = 0x3;
+
+    void Start();
+    // Returns true when the layout settled
+    bool Step(std::stop_token stop);
+    void Publish(bool settled);
+
+    // Empty once it ran
+    Setup setup;
+    State state;
+
+    std::array<Snapshot, 3> buffers;
+    // Owned by the worker and the UI, the shared one is in 'middle' along with FreshSnapshot when the UI hasn't seen it yet
+    u8 back, front;
+    std::atomic<u8> middle;
+    bool settled;
+
+#ifndef GRAPHEXIA_NO_THREADS
+    // Last, so it's stopped and joined before anything it uses is destroyed
+    std::jthread worker;
+#endif
+};
+
+#endif
@@ -55,6 +55,7 @@ public:
 
     sg_image BatchedImage() { return m.batchedImage; }
     std::array<BatchedData, TotalBatchedSize>& Data() { return *m.batched.get(); }
+    const std::array<BatchedData, TotalBatchedSize>& Data() const { return *m.batched.get(); }
     void FlagDirty() { m.batchDirty = true; }
 
     void SetBatchedCount(usize newBatched) { this->FlagDirty(); m.currentBatched = newBatched; }
@@ -0,0 +1,370 @@
+#include "Workspace.hpp"
+#include "GraphViewRenderer.hpp"
+
+#include <Graphexia/GraphFile.hpp>
+#include <Graphexia/MappedFile.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <fstream>
+
+struct WorkspaceJournalHeader {
+    std::array<char, 8> magic;
+    u32 version;
+    u32 reserved;
+    u64 snapshotHash;
+};
+
+void WorkspaceJournal::WriteId(usize id) {
+    for (; id >= 0x80; id >>= 7) {
+        this->records.push_back(static_cast<u8>(id | 0x80));
+    }
+
+    this->records.push_back(static_cast<u8>(id));
+}
+
+void WorkspaceJournal::WriteF32(f32 value) {
+    u32 bits = std::bit_cast<u32>(value);
+
+    for (usize i = 0; i < sizeof(bits); ++i) {
+        this->records.push_back(static_cast<u8>(bits >> (8 * i)));
+    }
+}
+
+void WorkspaceJournal::AddVertex(f32x2 position) {
+    this->Write(WorkspaceRecord::AddVertex);
+    this->WriteF32(position.x);
+    this->WriteF32(position.y);
+}
+
+void WorkspaceJournal::EraseVertex(usize id) {
+    this->Write(WorkspaceRecord::EraseVertex);
+    this->WriteId(id);
+}
+
+void WorkspaceJournal::AddEdge(usize from, usize to, f32 weight) {
+    this->Write(WorkspaceRecord::AddEdge);
+    this->WriteId(from);
+    this->WriteId(to);
+    this->WriteF32(weight);
+}
+
+void WorkspaceJournal::EraseEdge(usize id) {
+    this->Write(WorkspaceRecord::EraseEdge);
+    this->WriteId(id);
+}
+
+void WorkspaceJournal::MoveVertex(usize id, f32x2 position) {
+    this->Write(WorkspaceRecord::MoveVertex);
+    this->WriteId(id);
+    this->WriteF32(position.x);
+    this->WriteF32(position.y);
+}
+
+void WorkspaceJournal::EdgeWeight(usize id, f32 weight) {
+    this->Write(WorkspaceRecord::EdgeWeight);
+    this->WriteId(id);
+    this->WriteF32(weight);
+}
+
+void WorkspaceJournal::VertexLabel(usize id, std::string_view label) {
+    label = label.substr(0, Vertex::MaxLabelLength);
+
+    this->Write(WorkspaceRecord::VertexLabel);
+    this->WriteId(id);
+    this->records.push_back(static_cast<u8>(label.size()));
+    this->records.insert(this->records.end(), label.begin(), label.end());
+}
+
+void WorkspaceJournal::SetDirected(bool directed) {
+    this->Write(WorkspaceRecord::Directed);
+    this->records.push_back(directed);
+}
+
+std::filesystem::path WorkspaceJournalPath(const std::filesystem::path& path) {
+    std::filesystem::path journal = path;
+    journal += ".journal";
+    return journal;
+}
+
+// Not cryptographic, only tells snapshots apart. Word at a time so hashing a large snapshot stays cheap.
+static u64 HashSnapshot(std::span<const u8> bytes) {
+    u64 hash = 0x9E3779B97F4A7C15ull ^ bytes.size();
+
+    usize words = bytes.size() / sizeof(u64);
+    for (usize i = 0; i < words; ++i) {
+        u64 word;
+        std::memcpy(&word, bytes.data() + i * sizeof(u64), sizeof(u64));
+        hash = std::rotl(hash ^ word, 29) * 0xBF58476D1CE4E5B9ull;
+    }
+
+    for (usize i = words * sizeof(u64); i < bytes.size(); ++i) {
+        hash = std::rotl(hash ^ bytes[i], 29) * 0xBF58476D1CE4E5B9ull;
+    }
+
+    return hash ^ (hash >> 31);
+}
+
+static bool StartJournal(const std::filesystem::path& path, u64 snapshotHash) {
+    std::ofstream stream(WorkspaceJournalPath(path), std::ios::binary | std::ios::trunc);
+    if(!stream) {
+        return false;
+    }
+
+    WorkspaceJournalHeader header{WorkspaceJournalMagic, WorkspaceJournalVersion, 0, snapshotHash};
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    return static_cast<bool>(stream);
+}
+
+bool SaveWorkspace(const std::filesystem::path& path, const WorkspaceState& state) {
+    const gpx::Graph& graph = state.view.GetGraph();
+    GraphViewAttributes attributes = state.view.Attributes();
+
+    gpx::VertexAttributes vertexAttributes = attributes.View();
+    vertexAttributes.colors = state.vertexColors;
+
+    std::filesystem::path temporary = path;
+    temporary += ".tmp";
+
+    if(!gpx::WriteGraphFile(temporary, graph, vertexAttributes, gpx::EdgeAttributes{state.edgeColors})) {
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    if(error) {
+        return false;
+    }
+
+    // A crash from here until the new journal is written leaves the old one, its hash no longer matches so it's ignored
+    std::optional<gpx::MappedFile> snapshot = gpx::MappedFile::Open(path);
+    return snapshot && StartJournal(path, HashSnapshot(snapshot->Bytes()));
+}
+
+bool AppendWorkspaceJournal(const std::filesystem::path& path, std::span<const u8> records) {
+    std::filesystem::path journal = WorkspaceJournalPath(path);
+
+    std::error_code error;
+    if(!std::filesystem::exists(journal, error)) {
+        return false;
+    }
+
+    std::ofstream stream(journal, std::ios::binary | std::ios::app);
+    stream.write(reinterpret_cast<const char*>(records.data()), static_cast<std::streamsize>(records.size()));
+    stream.flush();
+    return static_cast<bool>(stream);
+}
+
+// Reads records one by one, any read past the end marks the cursor as failed
+struct JournalCursor {
+    std::span<const u8> bytes;
+    usize position;
+    bool failed;
+
+    bool AtEnd() const { return this->position >= this->bytes.size(); }
+
+    u8 ReadU8() {
+        if(this->position >= this->bytes.size()) {
+            this->failed = true;
+            return 0;
+        }
+
+        return this->bytes[this->position++];
+    }
+
+    usize ReadId() {
+        usize id = 0;
+
+        for (usize shift = 0; shift < 64; shift += 7) {
+            u8 byte = this->ReadU8();
+            id |= static_cast<usize>(byte & 0x7F) << shift;
+
+            if(!(byte & 0x80)) {
+                return id;
+            }
+        }
+
+        this->failed = true;
+        return 0;
+    }
+
+    f32 ReadF32() {
+        u32 bits = 0;
+
+        for (usize i = 0; i < sizeof(bits); ++i) {
+            bits |= static_cast<u32>(this->ReadU8()) << (8 * i);
+        }
+
+        return std::bit_cast<f32>(bits);
+    }
+};
+
+// Applies a single record, false when it is torn or refers to something that doesn't exist
+static bool ReplayRecord(JournalCursor& cursor, WorkspaceState& state) {
+    GraphView& view = state.view;
+    usize vertices = view.Vertices().size();
+    usize edges = view.GetGraph().Edges().size();
+
+    switch(static_cast<WorkspaceRecord>(cursor.ReadU8())) {
+        case WorkspaceRecord::AddVertex: {
+            f32x2 position = {cursor.ReadF32(), cursor.ReadF32()};
+            if(cursor.failed) {
+                return false;
+            }
+
+            view.AddVertex(position);
+            state.vertexColors.push_back(0xFFFFFFFF);
+            return true;
+        }
+        case WorkspaceRecord::EraseVertex: {
+            usize id = cursor.ReadId();
+            if(cursor.failed || id >= vertices) {
+                return false;
+            }
+
+            // Erasing a vertex erases its edges, keep the edge colors of the survivors
+            const std::vector<gpx::Edge>& edgeList = view.GetGraph().Edges();
+            std::vector<u32> edgeColors;
+            edgeColors.reserve(edges);
+
+            for (usize i = 0; i < edges; ++i) {
+                if(edgeList[i].fromId != id && edgeList[i].toId != id) {
+                    edgeColors.push_back(state.edgeColors[i]);
+                }
+            }
+
+            view.EraseVertex(id);
+            state.vertexColors.erase(state.vertexColors.begin() + id);
+            state.edgeColors = std::move(edgeColors);
+            return true;
+        }
+        case WorkspaceRecord::AddEdge: {
+            usize from = cursor.ReadId();
+            usize to = cursor.ReadId();
+            f32 weight = cursor.ReadF32();
+            if(cursor.failed || from >= vertices || to >= vertices) {
+                return false;
+            }
+
+            view.AddEdge(from, to, weight);
+            state.edgeColors.push_back(0xFFFFFFFF);
+            return true;
+        }
+        case WorkspaceRecord::EraseEdge: {
+            usize id = cursor.ReadId();
+            if(cursor.failed || id >= edges) {
+                return false;
+            }
+
+            view.EraseEdge(id);
+            state.edgeColors.erase(state.edgeColors.begin() + id);
+            return true;
+        }
+        case WorkspaceRecord::MoveVertex: {
+            usize id = cursor.ReadId();
+            f32x2 position = {cursor.ReadF32(), cursor.ReadF32()};
+            if(cursor.failed || id >= vertices) {
+                return false;
+            }
+
+            view.MoveVertex(id, position);
+            return true;
+        }
+        case WorkspaceRecord::EdgeWeight: {
+            usize id = cursor.ReadId();
+            f32 weight = cursor.ReadF32();
+            if(cursor.failed || id >= edges) {
+                return false;
+            }
+
+            view.EdgeWeight(id) = weight;
+            return true;
+        }
+        case WorkspaceRecord::VertexLabel: {
+            usize id = cursor.ReadId();
+            usize length = cursor.ReadU8();
+            if(cursor.failed || id >= vertices || length > Vertex::MaxLabelLength || length > cursor.bytes.size() - cursor.position) {
+                return false;
+            }
+
+            Vertex& vertex = view.View(id);
+            std::memcpy(vertex.label.data(), cursor.bytes.data() + cursor.position, length);
+            vertex.labelSize = static_cast<u8>(length);
+            cursor.position += length;
+            return true;
+        }
+        case WorkspaceRecord::Directed: {
+            u8 directed = cursor.ReadU8();
+            if(cursor.failed) {
+                return false;
+            }
+
+            view.SetDirected(directed != 0);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::optional<WorkspaceState> LoadWorkspace(const std::filesystem::path& path) {
+    std::optional<gpx::MappedFile> snapshotFile = gpx::MappedFile::Open(path);
+    std::optional<gpx::MappedGraph> snapshot = gpx::MappedGraph::Open(path);
+    if(!snapshotFile || !snapshot || !snapshot->Validate()) {
+        return std::nullopt;
+    }
+
+    usize vertices = snapshot->Vertices();
+    usize edges = snapshot->EdgeCount();
+
+    WorkspaceState state;
+    if(snapshot->HasPositions()) {
+        state.view = GraphView(snapshot->ToGraph(), FixedGraphViewRenderer(snapshot->Positions()));
+    } else {
+        state.view = GraphView(snapshot->ToGraph(), CircularGraphViewRenderer({}, 10.f + vertices * 2.2f, vertices));
+    }
+
+    for (usize i = 0; snapshot->HasLabels() && i < vertices; ++i) {
+        std::string_view label = snapshot->Label(i).substr(0, Vertex::MaxLabelLength);
+        Vertex& vertex = state.view.View(i);
+
+        std::copy(label.begin(), label.end(), vertex.label.begin());
+        vertex.labelSize = static_cast<u8>(label.size());
+    }
+
+    state.vertexColors = snapshot->HasVertexColors() ? std::vector<u32>(snapshot->VertexColors().begin(), snapshot->VertexColors().end()) : std::vector<u32>(vertices, 0xFFFFFFFF);
+    state.edgeColors = snapshot->HasEdgeColors() ? std::vector<u32>(snapshot->EdgeColors().begin(), snapshot->EdgeColors().end()) : std::vector<u32>(edges, 0xFFFFFFFF);
+
+    // Missing or foreign journals just mean there's nothing to replay, a fresh one is started so autosaves have somewhere to go
+    u64 snapshotHash = HashSnapshot(snapshotFile->Bytes());
+    std::optional<gpx::MappedFile> journal = gpx::MappedFile::Open(WorkspaceJournalPath(path));
+
+    WorkspaceJournalHeader header{};
+    if(journal && journal->Size() >= sizeof(header)) {
+        std::memcpy(&header, journal->Data(), sizeof(header));
+    }
+
+    if(header.magic != WorkspaceJournalMagic || header.version != WorkspaceJournalVersion || header.snapshotHash != snapshotHash) {
+        journal.reset();
+        StartJournal(path, snapshotHash);
+        return state;
+    }
+
+    JournalCursor cursor{journal->Bytes().subspan(sizeof(header)), 0, false};
+    usize replayed = 0;
+
+    while (!cursor.AtEnd() && ReplayRecord(cursor, state)) {
+        replayed = cursor.position;
+    }
+
+    // Cut a torn tail off, records appended after it would never be replayed otherwise
+    if(replayed != cursor.bytes.size()) {
+        journal.reset();
+
+        std::error_code error;
+        std::filesystem::resize_file(WorkspaceJournalPath(path), sizeof(header) + replayed, error);
+    }
+
+    return state;
+}
@@ -0,0 +1,71 @@
+#ifndef _GRAPHEXIA_APP_WORKSPACE__HPP_
+#define _GRAPHEXIA_APP_WORKSPACE__HPP_
+
+#include "Core.hpp"
+#include "GraphView.hpp"
+
+#include <array>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+// A workspace is a .gpxg snapshot (graph, positions, labels and colors) plus a journal next to it, '<path>.journal'.
+// Edits are appended to the journal as small records and replayed over the snapshot when loading, the snapshot is only
+// rewritten when the journal is compacted into it. The journal remembers a hash of the snapshot it belongs to, so a journal
+// left behind by an interrupted compaction (already contained in the new snapshot) is ignored instead of applied twice.
+constexpr std::array<char, 8> WorkspaceJournalMagic = {'G', 'P', 'X', 'J', 'O', 'U', 'R', 'N'};
+constexpr u32 WorkspaceJournalVersion = 1;
+
+enum class WorkspaceRecord : u8 {
+    AddVertex,   // f32 x, f32 y
+    EraseVertex, // id
+    AddEdge,     // from, to, f32 weight
+    EraseEdge,   // id
+    MoveVertex,  // id, f32 x, f32 y
+    EdgeWeight,  // id, f32 weight
+    VertexLabel, // id, u8 length, bytes
+    Directed,    // u8
+};
+
+// The colors are owned by the renderer, they are carried next to the view. 0xRRGGBBAA per vertex / edge.
+struct WorkspaceState {
+    GraphView view;
+    std::vector<u32> vertexColors;
+    std::vector<u32> edgeColors;
+};
+
+// Records waiting to be appended to the journal. Ids are LEB128 varints, everything else little endian.
+class WorkspaceJournal final {
+public:
+    void AddVertex(f32x2 position);
+    void EraseVertex(usize id);
+    void AddEdge(usize from, usize to, f32 weight);
+    void EraseEdge(usize id);
+    void MoveVertex(usize id, f32x2 position);
+    void EdgeWeight(usize id, f32 weight);
+    void VertexLabel(usize id, std::string_view label);
+    void SetDirected(bool directed);
+
+    bool Empty() const { return this->records.empty(); }
+    std::span<const u8> Records() const { return this->records; }
+    void Clear() { this->records.clear(); }
+private:
+    void Write(WorkspaceRecord record) { this->records.push_back(static_cast<u8>(record)); }
+    void WriteId(usize id);
+    void WriteF32(f32 value);
+
+    std::vector<u8> records;
+};
+
+std::filesystem::path WorkspaceJournalPath(const std::filesystem::path& path);
+
+// Writes a new snapshot (to a temporary file renamed over the old one) and starts an empty journal for it
+bool SaveWorkspace(const std::filesystem::path& path, const WorkspaceState& state);
+// Appends records to the journal of the workspace at 'path', which must have been saved before
+bool AppendWorkspaceJournal(const std::filesystem::path& path, std::span<const u8> records);
+// Loads the snapshot and replays its journal, records after a torn or invalid one are dropped
+std::optional<WorkspaceState> LoadWorkspace(const std::filesystem::path& path);
+
+#endif
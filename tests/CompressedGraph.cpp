@@ -0,0 +1,153 @@
+#include "Test.hpp"
+
+#include <Graphexia/Algo/BFS.hpp>
+#include <Graphexia/CompressedGraph.hpp>
+#include <Graphexia/GraphCSR.hpp>
+#include <Graphexia/GraphTypes.hpp>
+#include <Graphexia/Random.hpp>
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+using namespace gpx;
+
+static void TestStreamVByteKnownAnswer() {
+    // Codes 0, 1, 2, 3 from the lowest bits up, data little endian
+    const u8 control[] = {0xE4, 0x01};
+    u8 data[10 + 2 + CompressedGraph::Padding] = {
+        0x01,
+        0x00, 0x01,
+        0x00, 0x00, 0x01,
+        0x00, 0x00, 0x00, 0x01,
+        0xFF, 0xFE, 0xCA
+    };
+
+    u32 values[5];
+    const u8* end = DecodeStreamVByte(control, data, values, 5);
+    GPX_CHECK(end == data + 12);
+    GPX_CHECK(values[0] == 1 && values[1] == 256 && values[2] == 65536 && values[3] == 16777216);
+    GPX_CHECK(values[4] == 0xFEFF);
+}
+
+// Every length mixed and counts that don't fill the last control byte, against a plain encoder
+static void TestStreamVByteRandom() {
+    CounterRandom generator(5);
+
+    for (const usize count : {1, 3, 4, 15, 16, 17, 129, 1000}) {
+        std::vector<u32> expected(count);
+        std::vector<u8> control((count + 3) / 4), data;
+
+        for (usize i = 0; i < count; ++i) {
+            usize bytes = 1 + generator.NextBelow(4);
+            u32 value = static_cast<u32>(generator() >> (64 - 8 * bytes));
+            value |= u32(1) << (8 * bytes - 8); // Exactly 'bytes' long
+            expected[i] = value;
+
+            control[i / 4] |= static_cast<u8>((bytes - 1) << (2 * (i % 4)));
+            for (usize b = 0; b < bytes; ++b) {
+                data.push_back(static_cast<u8>(value >> (8 * b)));
+            }
+        }
+
+        usize length = data.size();
+        data.resize(length + CompressedGraph::Padding);
+
+        std::vector<u32> values(count);
+        const u8* end = DecodeStreamVByte(control.data(), data.data(), values.data(), count);
+        GPX_CHECK(end == data.data() + length);
+        GPX_CHECK(values == expected);
+    }
+}
+
+static void CheckAgainstCSR(const Graph& graph) {
+    std::optional<CompressedGraph> compressed = CompressGraph(graph, 4);
+    GPX_CHECK(compressed.has_value());
+    if(!compressed) {
+        return;
+    }
+
+    GraphCSR csr = CreateCSR(graph);
+    GPX_CHECK(compressed->Vertices() == graph.Vertices() && compressed->Entries() == csr.Entries());
+    GPX_CHECK(compressed->IsDirected() == graph.IsDirected());
+
+    usize mismatches = 0;
+    for (usize v = 0; v < graph.Vertices(); ++v) {
+        std::vector<usize> expected(csr.Adjacent(v).begin(), csr.Adjacent(v).end());
+        std::sort(expected.begin(), expected.end());
+
+        std::vector<usize> visited;
+        compressed->ForEachAdjacent(v, [&visited](usize u, usize edge) {
+            visited.push_back(u);
+            GPX_CHECK(edge == CompressedGraph::NoEdge);
+        });
+
+        mismatches += compressed->Degree(v) != expected.size() || compressed->Adjacent(v) != expected || visited != expected;
+    }
+
+    GPX_CHECK(mismatches == 0);
+
+    // Same compression whatever the thread count
+    std::optional<CompressedGraph> single = CompressGraph(graph, 1);
+    GPX_CHECK(single && single->Data() == compressed->Data() && single->Checkpoints() == compressed->Checkpoints());
+}
+
+static void TestRoundTrip() {
+    Graph scaleFree = CreateBarabasiAlbert(5000, 3, 9);
+    CheckAgainstCSR(scaleFree);
+
+    scaleFree.SetDirected(true);
+    CheckAgainstCSR(scaleFree);
+
+    // Neighbours on both sides of the vertex (negative first gaps), duplicates, loops, a hub past the decode batch
+    // and gaps of every byte length
+    Graph graph(70000);
+    for (usize v = 1; v < 300; ++v) {
+        graph.AddEdge(150, v);
+    }
+
+    graph.AddEdge(3, 2);
+    graph.AddEdge(3, 2);
+    graph.AddEdge(7, 7);
+    graph.AddEdge(10, 69999);
+    graph.AddEdge(69999, 0);
+    graph.AddEdge(40000, 40300);
+    CheckAgainstCSR(graph);
+
+    graph.SetDirected(true);
+    CheckAgainstCSR(graph);
+
+    CheckAgainstCSR(Graph(0));
+    CheckAgainstCSR(Graph(100));
+}
+
+// It models AdjacencyGraph, so a BFS runs over the compressed lists
+static void TestTraversal() {
+    Graph graph = CreateBarabasiAlbert(3000, 2, 4);
+    graph.AddVertices(5);
+
+    std::optional<CompressedGraph> compressed = CompressGraph(graph);
+    GPX_CHECK(compressed.has_value());
+    if(!compressed) {
+        return;
+    }
+
+    // Neighbours come in another order, but the same vertices are reached
+    BFSState expected = SetupBFS(graph, 0, std::nullopt);
+    while(!IterateBFS(graph, expected)) {}
+
+    BFSState actual = SetupBFS(*compressed, 0, std::nullopt);
+    while(!IterateBFS(*compressed, actual)) {}
+
+    GPX_CHECK(actual.visitedVertices == expected.visitedVertices);
+    GPX_CHECK(actual.result.size() == expected.result.size());
+    GPX_CHECK(!actual.visitedVertices.back());
+}
+
+int main() {
+    TestStreamVByteKnownAnswer();
+    TestStreamVByteRandom();
+    TestRoundTrip();
+    TestTraversal();
+    return TestResult();
+}
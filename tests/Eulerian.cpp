@@ -0,0 +1,85 @@
+#include "Test.hpp"
+
+#include <Graphexia/Algo/Eulerian.hpp>
+
+#include <vector>
+
+using namespace gpx;
+
+// Every path must list edges.size() + 1 vertices, each edge joining the ones around it
+static bool ValidPath(const Graph& graph, const EulerianResult& result) {
+    if(result.vertices.size() != result.edges.size() + 1) {
+        return false;
+    }
+
+    std::vector<bool> used(graph.Edges().size());
+    for (usize i = 0; i < result.edges.size(); ++i) {
+        const Edge& edge = graph.Edges()[result.edges[i]];
+        usize from = result.vertices[i], to = result.vertices[i + 1];
+
+        bool forward = edge.fromId == from && edge.toId == to;
+        bool backward = !graph.IsDirected() && edge.fromId == to && edge.toId == from;
+        if(used[result.edges[i]] || (!forward && !backward)) {
+            return false;
+        }
+
+        used[result.edges[i]] = true;
+    }
+
+    return result.edges.size() == graph.Edges().size() && result.circuit == (result.vertices.front() == result.vertices.back());
+}
+
+static void TestEdgeless() {
+    EulerianResult empty = EulerianPath(Graph());
+    GPX_CHECK(empty.exists && empty.edges.empty() && empty.vertices.empty());
+
+    Graph isolated(3);
+    EulerianResult single = EulerianPath(isolated);
+    GPX_CHECK(single.exists && single.circuit && ValidPath(isolated, single));
+}
+
+static void TestPaths() {
+    // Square with a diagonal: 1 and 3 have odd degree, so only a path between them
+    Graph square(4);
+    square.AddEdge(0, 1);
+    square.AddEdge(1, 2);
+    square.AddEdge(2, 3);
+    square.AddEdge(3, 0);
+    square.AddEdge(1, 3);
+
+    EulerianResult path = EulerianPath(square);
+    GPX_CHECK(path.exists && !path.circuit && ValidPath(square, path));
+
+    // Directed cycle with a loop and a parallel pair
+    Graph cycle(3);
+    cycle.SetDirected(true);
+    cycle.AddEdge(0, 1);
+    cycle.AddEdge(1, 2);
+    cycle.AddEdge(2, 0);
+    cycle.AddEdge(1, 1);
+    cycle.AddEdge(0, 2);
+    cycle.AddEdge(2, 0);
+
+    EulerianResult circuit = EulerianPath(cycle);
+    GPX_CHECK(circuit.exists && circuit.circuit && ValidPath(cycle, circuit));
+
+    // Four odd vertices
+    Graph star(5);
+    for (usize v = 1; v < 5; ++v) {
+        star.AddEdge(0, v);
+    }
+
+    GPX_CHECK(!EulerianPath(star).exists);
+
+    // Disconnected edges
+    Graph split(4);
+    split.AddEdge(0, 1);
+    split.AddEdge(2, 3);
+    GPX_CHECK(!EulerianPath(split).exists);
+}
+
+int main() {
+    TestEdgeless();
+    TestPaths();
+    return TestResult();
+}
@@ -0,0 +1,140 @@
+#include "Test.hpp"
+
+#include <Graphexia/BufferedSink.hpp>
+#include <Graphexia/GraphExport.hpp>
+#include <Graphexia/GraphImport.hpp>
+#include <Graphexia/GraphTypes.hpp>
+
+#include <array>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+using namespace gpx;
+
+// Two labelled and placed vertices joined by a weighted edge plus an unweighted loop, labels that need escaping
+static Graph SmallGraph(bool directed) {
+    Graph graph(2);
+    graph.AddEdge(0, 1, 1.5f);
+    graph.AddEdge(1, 1);
+    graph.SetDirected(directed);
+    return graph;
+}
+
+static constexpr std::array<f32, 4> SmallPositions = {0.f, -2.5f, 10.f, .1f};
+static constexpr std::array<std::string_view, 2> SmallLabels = {"a \"quoted\" \\ label", "<b> & 'c'"};
+
+static void TestDOT() {
+    std::ostringstream directed;
+    GPX_CHECK(ExportDOT(directed, SmallGraph(true), VertexAttributes{SmallPositions, SmallLabels, {}}));
+    GPX_CHECK(directed.str() ==
+        "digraph G {\n"
+        "  0 [label=\"a \\\"quoted\\\" \\\\ label\" pos=\"0,-2.5!\"];\n"
+        "  1 [label=\"<b> & 'c'\" pos=\"10,0.1!\"];\n"
+        "  0 -> 1 [weight=1.5];\n"
+        "  1 -> 1;\n"
+        "}\n");
+
+    std::ostringstream plain;
+    GPX_CHECK(ExportDOT(plain, SmallGraph(false)));
+    GPX_CHECK(plain.str() ==
+        "graph G {\n"
+        "  0;\n"
+        "  1;\n"
+        "  0 -- 1 [weight=1.5];\n"
+        "  1 -- 1;\n"
+        "}\n");
+}
+
+static void TestGraphML() {
+    std::ostringstream stream;
+    GPX_CHECK(ExportGraphML(stream, SmallGraph(false), VertexAttributes{SmallPositions, SmallLabels, {}}));
+    GPX_CHECK(stream.str() ==
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<graphml xmlns=\"http://graphml.graphdrawing.org/xmlns\">\n"
+        "  <key id=\"label\" for=\"node\" attr.name=\"label\" attr.type=\"string\"/>\n"
+        "  <key id=\"x\" for=\"node\" attr.name=\"x\" attr.type=\"float\"/>\n"
+        "  <key id=\"y\" for=\"node\" attr.name=\"y\" attr.type=\"float\"/>\n"
+        "  <key id=\"weight\" for=\"edge\" attr.name=\"weight\" attr.type=\"float\"><default>0</default></key>\n"
+        "  <graph id=\"G\" edgedefault=\"undirected\">\n"
+        "    <node id=\"n0\"><data key=\"label\">a &quot;quoted&quot; \\ label</data><data key=\"x\">0</data><data key=\"y\">-2.5</data></node>\n"
+        "    <node id=\"n1\"><data key=\"label\">&lt;b&gt; &amp; &apos;c&apos;</data><data key=\"x\">10</data><data key=\"y\">0.1</data></node>\n"
+        "    <edge id=\"e0\" source=\"n0\" target=\"n1\"><data key=\"weight\">1.5</data></edge>\n"
+        "    <edge id=\"e1\" source=\"n1\" target=\"n1\"/>\n"
+        "  </graph>\n"
+        "</graphml>\n");
+
+    // Attributes of the wrong size are not written
+    std::ostringstream plain;
+    GPX_CHECK(ExportGraphML(plain, SmallGraph(true), VertexAttributes{std::span<const f32>(SmallPositions).first(2), {}, {}}));
+    GPX_CHECK(plain.str().find("<key id=\"x\"") == std::string::npos);
+    GPX_CHECK(plain.str().find("<node id=\"n1\"/>") != std::string::npos);
+    GPX_CHECK(plain.str().find("edgedefault=\"directed\"") != std::string::npos);
+}
+
+// Much larger than the sink buffer, with weights that need every digit to round trip
+static void TestEdgeListRoundTrip() {
+    Graph graph = CreateBarabasiAlbert(20000, 4, 3);
+    graph.SetDirected(true);
+    for (usize i = 0; i < graph.Edges().size(); ++i) {
+        graph.EdgeWeight(i) = i % 5 == 0 ? 0.f : 1.f / static_cast<f32>(i + 3) - 1e-3f * static_cast<f32>(i % 7);
+    }
+
+    std::ostringstream stream;
+    GPX_CHECK(ExportEdgeList(stream, graph));
+    GPX_CHECK(stream.str().size() > 1 << 16);
+
+    std::optional<Graph> parsed = ParseEdgeList(stream.str(), true, 4);
+    GPX_CHECK(parsed.has_value());
+    if(parsed) {
+        GPX_CHECK(parsed->Vertices() == graph.Vertices() && parsed->Edges().size() == graph.Edges().size());
+
+        usize mismatches = 0;
+        for (usize i = 0; i < graph.Edges().size() && i < parsed->Edges().size(); ++i) {
+            const Edge& expected = graph.Edges()[i];
+            const Edge& actual = parsed->Edges()[i];
+            mismatches += expected.fromId != actual.fromId || expected.toId != actual.toId || expected.weight != actual.weight;
+        }
+
+        GPX_CHECK(mismatches == 0);
+    }
+
+    std::ostringstream unweighted;
+    GPX_CHECK(ExportEdgeList(unweighted, SmallGraph(false), false));
+    GPX_CHECK(unweighted.str() == "# Undirected graph, vertices: 2 edges: 2\n0 1\n1 1\n");
+}
+
+static void TestFailedStream() {
+    std::ofstream closed;
+    GPX_CHECK(!ExportEdgeList(closed, SmallGraph(false)));
+    GPX_CHECK(!ExportDOT(closed, SmallGraph(false)));
+    GPX_CHECK(!ExportGraphML(closed, SmallGraph(false)));
+
+    // Small buffers flush many times and keep everything in order
+    std::ostringstream stream;
+    {
+        BufferedSink sink(stream, 1);
+        for (usize i = 0; i < 1000; ++i) {
+            sink.WriteNumber(i);
+            sink.Write(i % 2 ? "," : ";");
+        }
+    }
+
+    std::string expected;
+    for (usize i = 0; i < 1000; ++i) {
+        expected += std::to_string(i) + (i % 2 ? "," : ";");
+    }
+
+    GPX_CHECK(stream.str() == expected);
+}
+
+int main() {
+    TestDOT();
+    TestGraphML();
+    TestEdgeListRoundTrip();
+    TestFailedStream();
+    return TestResult();
+}
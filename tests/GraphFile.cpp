@@ -0,0 +1,216 @@
+#include "Test.hpp"
+
+#include <Graphexia/GraphFile.hpp>
+#include <Graphexia/GraphTypes.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace gpx;
+
+static std::filesystem::path TestPath(std::string_view name) {
+    return std::filesystem::temp_directory_path() / std::filesystem::path(std::string("graphexia-test-") + std::string(name));
+}
+
+static bool SameGraph(const Graph& a, const Graph& b) {
+    if(a.Vertices() != b.Vertices() || a.IsDirected() != b.IsDirected() || a.Edges().size() != b.Edges().size()) {
+        return false;
+    }
+
+    for (usize i = 0; i < a.Edges().size(); ++i) {
+        const Edge& x = a.Edges()[i];
+        const Edge& y = b.Edges()[i];
+
+        if(x.fromId != y.fromId || x.toId != y.toId || std::memcmp(&x.weight, &y.weight, sizeof(f32)) != 0) {
+            return false;
+        }
+    }
+
+    for (usize v = 0; v < a.Vertices(); ++v) {
+        if(a.EdgesForVertex(v) != b.EdgesForVertex(v)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Triangle 0-1-2, a loop on 2 and an isolated 3: the CSR is known by hand
+static void TestKnownLayout() {
+    Graph graph(4);
+    graph.AddEdge(0, 1, 1.5f);
+    graph.AddEdge(1, 2, -2.f);
+    graph.AddEdge(2, 0);
+    graph.AddEdge(2, 2, .25f);
+
+    std::filesystem::path path = TestPath("known.gpxg");
+    GPX_CHECK(WriteGraphFile(path, graph));
+
+    std::optional<MappedGraph> mapped = MappedGraph::Open(path);
+    GPX_CHECK(mapped.has_value());
+    if(!mapped) {
+        return;
+    }
+
+    GPX_CHECK(mapped->Validate());
+    GPX_CHECK(mapped->Vertices() == 4 && mapped->EdgeCount() == 4 && !mapped->IsDirected());
+    GPX_CHECK(!mapped->HasPositions() && !mapped->HasLabels() && !mapped->HasVertexColors() && !mapped->HasEdgeColors());
+
+    // Both directions of every edge, the loop twice
+    std::vector<u64> offsets(mapped->Offsets().begin(), mapped->Offsets().end());
+    GPX_CHECK((offsets == std::vector<u64>{0, 2, 4, 8, 8}));
+    GPX_CHECK(mapped->Degree(2) == 4 && mapped->Degree(3) == 0);
+
+    std::vector<u64> endpoints(mapped->Endpoints().begin(), mapped->Endpoints().end());
+    GPX_CHECK((endpoints == std::vector<u64>{0, 1, 1, 2, 2, 0, 2, 2}));
+    GPX_CHECK(mapped->EdgeAt(1).weight == -2.f);
+
+    std::vector<usize> adjacent;
+    mapped->ForEachAdjacent(2, [&adjacent](usize u, usize) { adjacent.push_back(u); });
+    std::sort(adjacent.begin(), adjacent.end());
+    GPX_CHECK((adjacent == std::vector<usize>{0, 1, 2, 2}));
+
+    // The header is the file format, not only whatever this build writes
+    std::ifstream stream(path, std::ios::binary);
+    GraphFileHeader header;
+    stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+    GPX_CHECK(static_cast<bool>(stream));
+    GPX_CHECK(header.magic == GraphFileMagic && header.version == 2 && header.entries == 8);
+    for (const GraphFileRange& range : header.sections) {
+        GPX_CHECK(range.offset % GraphFileAlignment == 0);
+    }
+
+    GPX_CHECK(SameGraph(mapped->ToGraph(), graph));
+    mapped.reset();
+    std::filesystem::remove(path);
+}
+
+static void TestRoundTrip(bool directed) {
+    Graph graph = CreateBarabasiAlbert(300, 3, 11);
+    graph.SetDirected(directed);
+    graph.AddEdge(5, 5, 3.f);
+    for (usize i = 0; i < graph.Edges().size(); ++i) {
+        graph.EdgeWeight(i) = static_cast<f32>(i) * .5f - 7.f;
+    }
+
+    usize vertices = graph.Vertices();
+    std::vector<f32> positions(2 * vertices);
+    std::vector<std::string> labelStorage(vertices);
+    std::vector<std::string_view> labels(vertices);
+    std::vector<u32> vertexColors(vertices);
+    std::vector<u32> edgeColors(graph.Edges().size());
+
+    for (usize v = 0; v < vertices; ++v) {
+        positions[2 * v] = static_cast<f32>(v);
+        positions[2 * v + 1] = -static_cast<f32>(v) / 3.f;
+        // Some labels empty, some multibyte
+        labelStorage[v] = v % 7 == 0 ? std::string() : "v" + std::to_string(v) + (v % 5 == 0 ? "\xC3\xA9" : "");
+        labels[v] = labelStorage[v];
+        vertexColors[v] = 0x01020300u + static_cast<u32>(v);
+    }
+
+    for (usize i = 0; i < edgeColors.size(); ++i) {
+        edgeColors[i] = 0xFF000000u ^ static_cast<u32>(i * 2654435761u);
+    }
+
+    std::filesystem::path path = TestPath(directed ? "directed.gpxg" : "undirected.gpxg");
+    GPX_CHECK(WriteGraphFile(path, graph, VertexAttributes{positions, labels, vertexColors}, EdgeAttributes{edgeColors}));
+
+    std::optional<MappedGraph> mapped = MappedGraph::Open(path);
+    GPX_CHECK(mapped.has_value());
+    if(!mapped) {
+        return;
+    }
+
+    GPX_CHECK(mapped->Validate());
+    GPX_CHECK(mapped->IsDirected() == directed);
+    GPX_CHECK(mapped->HasPositions() && mapped->HasLabels() && mapped->HasVertexColors() && mapped->HasEdgeColors());
+    GPX_CHECK(SameGraph(mapped->ToGraph(), graph));
+
+    GPX_CHECK(std::equal(positions.begin(), positions.end(), mapped->Positions().begin(), mapped->Positions().end()));
+    GPX_CHECK(std::equal(vertexColors.begin(), vertexColors.end(), mapped->VertexColors().begin(), mapped->VertexColors().end()));
+    GPX_CHECK(std::equal(edgeColors.begin(), edgeColors.end(), mapped->EdgeColors().begin(), mapped->EdgeColors().end()));
+    for (usize v = 0; v < vertices; ++v) {
+        GPX_CHECK(mapped->Label(v) == labels[v]);
+    }
+
+    // The mapped adjacency is the one of the graph it was written from
+    for (usize v = 0; v < vertices; ++v) {
+        std::vector<std::pair<usize, usize>> expected, actual;
+        graph.ForEachAdjacent(v, [&expected](usize u, usize edge) { expected.emplace_back(u, edge); });
+        mapped->ForEachAdjacent(v, [&actual](usize u, usize edge) { actual.emplace_back(u, edge); });
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+        GPX_CHECK(expected == actual);
+    }
+
+    mapped.reset();
+    std::filesystem::remove(path);
+}
+
+// Patches one header field of a valid file, Open must refuse every one of them
+static void TestRejects() {
+    Graph graph(3);
+    graph.AddEdge(0, 1);
+    graph.AddEdge(1, 2);
+
+    std::filesystem::path path = TestPath("rejects.gpxg");
+
+    auto rewrite = [&path, &graph](auto&& patch) {
+        WriteGraphFile(path, graph);
+
+        std::fstream stream(path, std::ios::binary | std::ios::in | std::ios::out);
+        GraphFileHeader header;
+        stream.read(reinterpret_cast<char*>(&header), sizeof(header));
+        patch(header);
+        stream.seekp(0);
+        stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    };
+
+    rewrite([](GraphFileHeader& header) { header.magic[0] = 'X'; });
+    GPX_CHECK(!MappedGraph::Open(path));
+
+    // Unknown versions, older or newer, are never guessed
+    rewrite([](GraphFileHeader& header) { header.version = GraphFileVersion + 1; });
+    GPX_CHECK(!MappedGraph::Open(path));
+    rewrite([](GraphFileHeader& header) { header.version = 1; });
+    GPX_CHECK(!MappedGraph::Open(path));
+
+    rewrite([](GraphFileHeader& header) { header.vertices += 1; });
+    GPX_CHECK(!MappedGraph::Open(path));
+
+    rewrite([](GraphFileHeader& header) { header.flags = header.flags | GraphFileFlags::Positions; });
+    GPX_CHECK(!MappedGraph::Open(path));
+
+    rewrite([](GraphFileHeader& header) { header.sections[static_cast<usize>(GraphFileSection::Weights)].offset += 4; });
+    GPX_CHECK(!MappedGraph::Open(path));
+
+    rewrite([](GraphFileHeader& header) { header.sections[static_cast<usize>(GraphFileSection::Weights)].offset = u64(1) << 40; });
+    GPX_CHECK(!MappedGraph::Open(path));
+
+    // Truncated to the header alone
+    WriteGraphFile(path, graph);
+    std::filesystem::resize_file(path, sizeof(GraphFileHeader));
+    GPX_CHECK(!MappedGraph::Open(path));
+
+    std::filesystem::resize_file(path, 4);
+    GPX_CHECK(!MappedGraph::Open(path));
+
+    std::filesystem::remove(path);
+    GPX_CHECK(!MappedGraph::Open(path));
+}
+
+int main() {
+    TestKnownLayout();
+    TestRoundTrip(false);
+    TestRoundTrip(true);
+    TestRejects();
+    return TestResult();
+}
@@ -0,0 +1,193 @@
+#include "Test.hpp"
+
+#include <Graphexia/GraphImport.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace gpx;
+
+static bool HasEdges(const Graph& graph, const std::vector<Edge>& expected) {
+    const std::vector<Edge>& edges = graph.Edges();
+    if(edges.size() != expected.size()) {
+        return false;
+    }
+
+    for (usize i = 0; i < edges.size(); ++i) {
+        if(edges[i].fromId != expected[i].fromId || edges[i].toId != expected[i].toId || edges[i].weight != expected[i].weight) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void TestEdgeList() {
+    std::optional<Graph> graph = ParseEdgeList(
+        "# comment\n"
+        "% other comment\n"
+        "0 1\n"
+        "\n"
+        "1 2 2.5\n"
+        "4\t0 -1 1700000000\n"
+        "2 2", true);
+
+    GPX_CHECK(graph.has_value());
+    if(graph) {
+        GPX_CHECK(graph->IsDirected() && graph->Vertices() == 5);
+        GPX_CHECK(HasEdges(*graph, {{0, 1, 0.f}, {1, 2, 2.5f}, {4, 0, -1.f}, {2, 2, 0.f}}));
+    }
+
+    std::optional<Graph> undirected = ParseEdgeList("3 1\r\n", false);
+    GPX_CHECK(undirected && !undirected->IsDirected() && undirected->Vertices() == 4 && HasEdges(*undirected, {{3, 1, 0.f}}));
+
+    std::optional<Graph> empty = ParseEdgeList("# nothing\n");
+    GPX_CHECK(empty && empty->Vertices() == 0 && empty->Edges().empty());
+
+    GPX_CHECK(!ParseEdgeList("0\n"));
+    GPX_CHECK(!ParseEdgeList("0 x\n"));
+    GPX_CHECK(!ParseEdgeList("0 -1\n"));
+    GPX_CHECK(!ParseEdgeList("0 1 heavy\n"));
+}
+
+static void TestDIMACS() {
+    std::optional<Graph> directed = ParseDIMACS(
+        "c shortest paths\n"
+        "p sp 3 2\n"
+        "a 1 2 7\n"
+        "c between\n"
+        "a 3 1 0.5\n");
+
+    GPX_CHECK(directed && directed->IsDirected() && directed->Vertices() == 3);
+    GPX_CHECK(directed && HasEdges(*directed, {{0, 1, 7.f}, {2, 0, .5f}}));
+
+    std::optional<Graph> coloring = ParseDIMACS(
+        "p edge 4 2\n"
+        "n 1 5\n"
+        "e 1 4\n"
+        "e 2 3\n");
+
+    GPX_CHECK(coloring && !coloring->IsDirected() && coloring->Vertices() == 4);
+    GPX_CHECK(coloring && HasEdges(*coloring, {{0, 3, 0.f}, {1, 2, 0.f}}));
+
+    GPX_CHECK(!ParseDIMACS("a 1 2\n"));
+    GPX_CHECK(!ParseDIMACS("p sp 2 1\na 0 1\n"));
+    GPX_CHECK(!ParseDIMACS("p sp 2 1\na 1 3\n"));
+    GPX_CHECK(!ParseDIMACS("p sp 2 1\nx 1 2\n"));
+}
+
+static void TestMETIS() {
+    // Path 1 - 2 - 3 with an isolated 4
+    std::optional<Graph> graph = ParseMETIS(
+        "% comment\n"
+        "4 2\n"
+        "2\n"
+        "1 3\n"
+        "% between\n"
+        "2\n"
+        "\n");
+
+    GPX_CHECK(graph && !graph->IsDirected() && graph->Vertices() == 4);
+    GPX_CHECK(graph && HasEdges(*graph, {{0, 1, 0.f}, {1, 2, 0.f}}));
+
+    // fmt 011: one vertex weight, then (neighbour, weight) pairs
+    std::optional<Graph> weighted = ParseMETIS(
+        "3 2 011\n"
+        "5 2 4 3 6\n"
+        "1 1 4\n"
+        "2 1 6\n");
+
+    GPX_CHECK(weighted && HasEdges(*weighted, {{0, 1, 4.f}, {0, 2, 6.f}}));
+
+    GPX_CHECK(!ParseMETIS("2 1\n3\n"));
+    GPX_CHECK(!ParseMETIS("2 1\n0\n"));
+    GPX_CHECK(!ParseMETIS("1 0\n\n1\n"));
+}
+
+static void TestMatrixMarket() {
+    std::optional<Graph> general = ParseMatrixMarket(
+        "%%MatrixMarket matrix coordinate real general\n"
+        "% comment\n"
+        "3 4 2\n"
+        "1 4 1.5\n"
+        "3 1 -2e1\n");
+
+    GPX_CHECK(general && general->IsDirected() && general->Vertices() == 4);
+    GPX_CHECK(general && HasEdges(*general, {{0, 3, 1.5f}, {2, 0, -20.f}}));
+
+    std::optional<Graph> pattern = ParseMatrixMarket(
+        "%%matrixmarket MATRIX Coordinate pattern symmetric\n"
+        "2 2 1\n"
+        "2 1\n");
+
+    GPX_CHECK(pattern && !pattern->IsDirected() && HasEdges(*pattern, {{1, 0, 0.f}}));
+
+    std::optional<Graph> complex = ParseMatrixMarket(
+        "%%MatrixMarket matrix coordinate complex hermitian\n"
+        "2 2 1\n"
+        "2 1 3 -4\n");
+
+    GPX_CHECK(complex && HasEdges(*complex, {{1, 0, 3.f}}));
+
+    GPX_CHECK(!ParseMatrixMarket("%%MatrixMarket matrix array real general\n2 2\n1\n2\n3\n4\n"));
+    GPX_CHECK(!ParseMatrixMarket("%%MatrixMarket matrix coordinate real general\n2 2 2\n1 1 1\n"));
+    GPX_CHECK(!ParseMatrixMarket("%%MatrixMarket matrix coordinate real general\n2 2 1\n3 1 1\n"));
+}
+
+// Several megabytes, so the text is split in many chunks: every thread count must give the same graph in file order
+static void TestChunks() {
+    constexpr usize Vertices = 100000;
+    constexpr usize Edges = 400000;
+
+    std::string text = "# large\n";
+    std::vector<Edge> expected;
+    expected.reserve(Edges);
+
+    for (usize i = 0; i < Edges; ++i) {
+        usize from = (i * 7919) % Vertices, to = (i * 104729 + 13) % Vertices;
+        f32 weight = static_cast<f32>(i % 1000) * .25f;
+
+        text += std::to_string(from) + ' ' + std::to_string(to) + ' ' + std::to_string(weight) + '\n';
+        if(i % 1000 == 0) {
+            text += "% checkpoint\n\n";
+        }
+
+        expected.push_back(Edge{from, to, weight});
+    }
+
+    for (const usize threads : {1, 3, 8}) {
+        std::optional<Graph> graph = ParseEdgeList(text, true, threads);
+        GPX_CHECK(graph && graph->Vertices() == Vertices && HasEdges(*graph, expected));
+    }
+
+    // A malformed line anywhere fails the whole parse
+    text.insert(text.size() / 2, "1 2 3\nbroken\n");
+    GPX_CHECK(!ParseEdgeList(text, true, 8));
+}
+
+static void TestLoad() {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / "graphexia-test-import.el";
+    {
+        std::ofstream stream(path, std::ios::binary);
+        stream << "0 1\n1 2 3\n";
+    }
+
+    std::optional<Graph> graph = LoadEdgeList(path, false);
+    GPX_CHECK(graph && !graph->IsDirected() && HasEdges(*graph, {{0, 1, 0.f}, {1, 2, 3.f}}));
+
+    std::filesystem::remove(path);
+    GPX_CHECK(!LoadEdgeList(path));
+}
+
+int main() {
+    TestEdgeList();
+    TestDIMACS();
+    TestMETIS();
+    TestMatrixMarket();
+    TestChunks();
+    TestLoad();
+    return TestResult();
+}
@@ -0,0 +1,149 @@
+#include "Test.hpp"
+
+#include <Graphexia/GraphCSR.hpp>
+#include <Graphexia/GraphTypes.hpp>
+#include <Graphexia/Layout/ForceLayout.hpp>
+#include <Graphexia/Layout/MultilevelLayout.hpp>
+#include <Graphexia/Layout/SpectralLayout.hpp>
+#include <Graphexia/Layout/StressLayout.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <stop_token>
+#include <vector>
+
+using namespace gpx;
+
+// Weights of 1 everywhere are the unweighted layout, step by step
+static void TestUnitWeights(ForceModel model) {
+    Graph graph = CreateBarabasiAlbert(500, 2, 6);
+    GraphCSR csr = CreateCSR(graph, CSRDirection::Both);
+
+    ForceLayoutOptions options;
+    options.model = model;
+    options.threads = 1;
+
+    std::vector<f32> vertexWeights(csr.Vertices(), 1.f);
+    ForceLayoutState plain = SetupForceLayout(GraphCSR(csr), options);
+    ForceLayoutState weighted = SetupForceLayout(GraphCSR(csr), std::vector<f32>(csr.Entries(), 1.f), vertexWeights, options);
+
+    GPX_CHECK(plain.masses == weighted.masses);
+    GPX_CHECK(plain.weights.empty() && weighted.weights.size() == csr.Entries());
+
+    for (usize i = 0; i < 20; ++i) {
+        IterateForceLayout(plain);
+        IterateForceLayout(weighted);
+    }
+
+    GPX_CHECK(plain.x == weighted.x && plain.y == weighted.y);
+}
+
+static void TestWeightedMasses() {
+    // Star with center 0 and 3 leaves
+    Graph graph(4);
+    graph.AddEdge(0, 1);
+    graph.AddEdge(0, 2);
+    graph.AddEdge(0, 3);
+    GraphCSR csr = CreateCSR(graph, CSRDirection::Both);
+
+    std::vector<f32> weights(csr.Entries(), 2.f);
+    std::vector<f32> vertexWeights = {3.f, 1.f, 1.f, 5.f};
+
+    ForceLayoutState atlas = SetupForceLayout(GraphCSR(csr), std::vector<f32>(weights), vertexWeights);
+    GPX_CHECK((atlas.masses == std::vector<f32>{9.f, 3.f, 3.f, 7.f}));
+
+    ForceLayoutOptions options;
+    options.model = ForceModel::FruchtermanReingold;
+    ForceLayoutState fruchterman = SetupForceLayout(GraphCSR(csr), std::vector<f32>(weights), vertexWeights, options);
+    GPX_CHECK(fruchterman.masses == vertexWeights);
+
+    // Weights that don't match the graph are ignored
+    ForceLayoutState mismatched = SetupForceLayout(GraphCSR(csr), std::vector<f32>(1, 2.f), std::vector<f32>(2, 3.f));
+    GPX_CHECK(mismatched.weights.empty() && (mismatched.masses == std::vector<f32>{4.f, 2.f, 2.f, 2.f}));
+}
+
+static void TestMultilevel() {
+    Graph graph = CreateBarabasiAlbert(3000, 2, 8);
+
+    MultilevelLayoutOptions options;
+    options.force.threads = 2;
+    std::vector<f32> positions = MultilevelLayout(graph, options);
+
+    GPX_CHECK(positions.size() == 2 * graph.Vertices());
+
+    usize nonFinite = 0;
+    for (const f32 value : positions) {
+        nonFinite += !std::isfinite(value);
+    }
+
+    GPX_CHECK(nonFinite == 0);
+}
+
+static Graph SmallGraph(usize vertices, bool complete) {
+    Graph graph(vertices);
+
+    for (usize v = 0; v < vertices; ++v) {
+        for (usize u = v + 1; u < (complete ? vertices : std::min(v + 2, vertices)); ++u) {
+            graph.AddEdge(v, u);
+        }
+    }
+
+    return graph;
+}
+
+// Finite and not every vertex on the same point
+static bool Spread(std::span<const f32> positions) {
+    bool spread = false;
+
+    for (usize i = 0; i < positions.size(); ++i) {
+        if(!std::isfinite(positions[i])) {
+            return false;
+        }
+
+        spread |= positions[i] != positions[i % 2];
+    }
+
+    return spread;
+}
+
+// Fewer vertices than the Lanczos basis wants (the default view is K4)
+static void TestSmallGraphs() {
+    for (const usize vertices : {3, 4, 5}) {
+        for (const bool complete : {false, true}) {
+            Graph graph = SmallGraph(vertices, complete);
+
+            SpectralLayoutOptions spectralOptions;
+            spectralOptions.threads = 1;
+            SpectralLayoutResult spectral = SpectralLayout(graph, spectralOptions);
+            GPX_CHECK(spectral.positions.size() == 2 * vertices && Spread(spectral.positions));
+
+            StressLayoutOptions stressOptions;
+            stressOptions.threads = 1;
+            std::vector<f32> stress = StressLayout(graph, stressOptions);
+            GPX_CHECK(stress.size() == 2 * vertices && Spread(stress));
+        }
+    }
+}
+
+// A stop requested up front ends the spectral layout before its first product
+static void TestStoppedSpectral() {
+    std::stop_source source;
+    source.request_stop();
+
+    SpectralLayoutOptions options;
+    options.stop = source.get_token();
+
+    SpectralLayoutResult result = SpectralLayout(CreateBarabasiAlbert(1000, 2, 2), options);
+    GPX_CHECK(!result.converged && result.iterations == 0 && result.positions.size() == 2000);
+}
+
+int main() {
+    TestUnitWeights(ForceModel::ForceAtlas2);
+    TestUnitWeights(ForceModel::FruchtermanReingold);
+    TestWeightedMasses();
+    TestMultilevel();
+    TestSmallGraphs();
+    TestStoppedSpectral();
+    return TestResult();
+}
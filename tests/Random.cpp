@@ -0,0 +1,118 @@
+#include "Test.hpp"
+
+#include <Graphexia/Random.hpp>
+
+#include <array>
+#include <vector>
+
+using namespace gpx;
+
+// Known answers of Philox4x32-10 from the Random123 distribution (kat_vectors)
+struct PhiloxVector {
+    std::array<u32, 4> counter;
+    std::array<u32, 2> key;
+    std::array<u32, 4> expected;
+};
+
+static constexpr std::array<PhiloxVector, 3> PhiloxVectors = {{
+    { {0x00000000, 0x00000000, 0x00000000, 0x00000000}, {0x00000000, 0x00000000}, {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8} },
+    { {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}, {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd} },
+    { {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}, {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1} },
+}};
+
+static_assert(Philox4x32(PhiloxVectors[0].counter, PhiloxVectors[0].key) == PhiloxVectors[0].expected);
+
+static void TestPhiloxKnownAnswers() {
+    for (const PhiloxVector& vector : PhiloxVectors) {
+        GPX_CHECK(Philox4x32(vector.counter, vector.key) == vector.expected);
+    }
+}
+
+// Every lane must be the scalar block of its own counter
+static void TestPhiloxLanes() {
+    constexpr usize Lanes = 8;
+    std::array<u32, 2> key = {0xa4093822, 0x299f31d0};
+
+    std::array<std::array<u32, Lanes>, 4> counter;
+    for (usize l = 0; l < Lanes; ++l) {
+        counter[0][l] = static_cast<u32>(l * 0x9E3779B9u);
+        counter[1][l] = static_cast<u32>(l);
+        counter[2][l] = 0xffffffffu - static_cast<u32>(l);
+        counter[3][l] = 7;
+    }
+
+    std::array<std::array<u32, Lanes>, 4> blocks = counter;
+    Philox4x32Lanes(blocks, key);
+
+    for (usize l = 0; l < Lanes; ++l) {
+        std::array<u32, 4> expected = Philox4x32({counter[0][l], counter[1][l], counter[2][l], counter[3][l]}, key);
+        GPX_CHECK((std::array<u32, 4>{blocks[0][l], blocks[1][l], blocks[2][l], blocks[3][l]}) == expected);
+    }
+}
+
+static void TestCounterRandom() {
+    // Block 0 of (seed 0, stream 0) is the first known answer, handed out as two u64 (high words first)
+    CounterRandom zero(0);
+    GPX_CHECK(zero() == 0x9b00dbd8bc57ac4cull);
+    GPX_CHECK(zero() == 0xe169c58d6627e8d5ull);
+
+    // The stream goes in the high counter words and the seed in the key
+    CounterRandom pi(0x299f31d0a4093822ull, 0x0370734413198a2eull);
+    std::array<u32, 4> block = Philox4x32({0, 0, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0});
+    GPX_CHECK(pi() == ((static_cast<u64>(block[3]) << 32) | block[2]));
+    GPX_CHECK(pi() == ((static_cast<u64>(block[1]) << 32) | block[0]));
+
+    CounterRandom a(42, 3), b(42, 3), otherStream(42, 4), otherSeed(43, 3);
+    usize sameStream = 0, sameSeed = 0;
+    for (usize i = 0; i < 1000; ++i) {
+        u64 value = a();
+        GPX_CHECK(value == b());
+
+        sameStream += value == otherStream();
+        sameSeed += value == otherSeed();
+    }
+
+    GPX_CHECK(sameStream == 0);
+    GPX_CHECK(sameSeed == 0);
+}
+
+static void TestDistributions() {
+    CounterRandom generator(7);
+
+    for (usize i = 0; i < 10000; ++i) {
+        f64 unit = generator.NextUnit();
+        GPX_CHECK(unit >= 0.0 && unit < 1.0);
+    }
+
+    GPX_CHECK(generator.NextBelow(1) == 0);
+
+    // 6 buckets of 60000 draws, every one within 5% of its expected 10000
+    constexpr u64 Bound = 6;
+    std::vector<usize> histogram(Bound);
+    for (usize i = 0; i < 60000; ++i) {
+        u64 value = generator.NextBelow(Bound);
+        GPX_CHECK(value < Bound);
+
+        if(value < Bound) {
+            ++histogram[value];
+        }
+    }
+
+    for (const usize count : histogram) {
+        GPX_CHECK(count > 9500 && count < 10500);
+    }
+
+    // Bounds close to 2^64 reject most of the range and still land below it
+    u64 large = (1ull << 63) + 1;
+    for (usize i = 0; i < 100; ++i) {
+        GPX_CHECK(generator.NextBelow(large) < large);
+    }
+}
+
+int main() {
+    TestPhiloxKnownAnswers();
+    TestPhiloxLanes();
+    TestCounterRandom();
+    TestDistributions();
+    return TestResult();
+}
@@ -0,0 +1,26 @@
+#ifndef _GRAPHEXIA_TESTS_TEST__HPP_
+#define _GRAPHEXIA_TESTS_TEST__HPP_
+
+#include <cstdio>
+
+// Every test is its own executable: failed checks are printed and keep going, TestResult() is what main returns.
+inline int testFailures = 0;
+
+#define GPX_CHECK(condition) \
+    do { \
+        if(!(condition)) { \
+            std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            ++testFailures; \
+        } \
+    } while(0)
+
+inline int TestResult() {
+    if(testFailures != 0) {
+        std::fprintf(stderr, "%d check(s) failed\n", testFailures);
+        return 1;
+    }
+
+    return 0;
+}
+
+#endif
@@ -0,0 +1,270 @@
+#include "Test.hpp"
+
+#include "Workspace.hpp"
+
+#include <Graphexia/GraphTypes.hpp>
+
+#include <bit>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+static std::filesystem::path TestPath(std::string_view name) {
+    return std::filesystem::temp_directory_path() / std::filesystem::path(std::string("graphexia-test-") + std::string(name));
+}
+
+// Magic, version, reserved and the snapshot hash
+static constexpr u64 JournalHeaderSize = 24;
+
+static void RemoveWorkspace(const std::filesystem::path& path) {
+    std::filesystem::remove(path);
+    std::filesystem::remove(WorkspaceJournalPath(path));
+}
+
+static bool SameState(const WorkspaceState& a, const WorkspaceState& b) {
+    const gpx::Graph& x = a.view.GetGraph();
+    const gpx::Graph& y = b.view.GetGraph();
+
+    if(x.Vertices() != y.Vertices() || x.IsDirected() != y.IsDirected() || x.Edges().size() != y.Edges().size()) {
+        return false;
+    }
+
+    for (usize i = 0; i < x.Edges().size(); ++i) {
+        const gpx::Edge& e = x.Edges()[i];
+        const gpx::Edge& f = y.Edges()[i];
+
+        if(e.fromId != f.fromId || e.toId != f.toId || std::bit_cast<u32>(e.weight) != std::bit_cast<u32>(f.weight)) {
+            return false;
+        }
+    }
+
+    for (usize v = 0; v < x.Vertices(); ++v) {
+        const Vertex& p = a.view.Vertices()[v];
+        const Vertex& q = b.view.Vertices()[v];
+
+        if(p.position.x != q.position.x || p.position.y != q.position.y || std::string_view(p.label.data(), p.labelSize) != std::string_view(q.label.data(), q.labelSize)) {
+            return false;
+        }
+    }
+
+    return a.vertexColors == b.vertexColors && a.edgeColors == b.edgeColors;
+}
+
+// Edits a state the way the app does and records them in a journal, loading must give the same state back
+struct Editor {
+    WorkspaceState state;
+    WorkspaceJournal journal;
+
+    void AddVertex(f32x2 position) {
+        this->state.view.AddVertex(position);
+        this->state.vertexColors.push_back(0xFFFFFFFF);
+        this->journal.AddVertex(position);
+    }
+
+    void AddEdge(usize from, usize to, f32 weight) {
+        this->state.view.AddEdge(from, to, weight);
+        this->state.edgeColors.push_back(0xFFFFFFFF);
+        this->journal.AddEdge(from, to, weight);
+    }
+
+    void EraseEdge(usize id) {
+        this->state.view.EraseEdge(id);
+        this->state.edgeColors.erase(this->state.edgeColors.begin() + id);
+        this->journal.EraseEdge(id);
+    }
+
+    void EraseVertex(usize id) {
+        const std::vector<gpx::Edge>& edges = this->state.view.GetGraph().Edges();
+        std::vector<u32> edgeColors;
+
+        for (usize i = 0; i < edges.size(); ++i) {
+            if(edges[i].fromId != id && edges[i].toId != id) {
+                edgeColors.push_back(this->state.edgeColors[i]);
+            }
+        }
+
+        this->state.view.EraseVertex(id);
+        this->state.vertexColors.erase(this->state.vertexColors.begin() + id);
+        this->state.edgeColors = std::move(edgeColors);
+        this->journal.EraseVertex(id);
+    }
+
+    void MoveVertex(usize id, f32x2 position) {
+        this->state.view.MoveVertex(id, position);
+        this->journal.MoveVertex(id, position);
+    }
+
+    void EdgeWeight(usize id, f32 weight) {
+        this->state.view.EdgeWeight(id) = weight;
+        this->journal.EdgeWeight(id, weight);
+    }
+
+    void VertexLabel(usize id, std::string_view label) {
+        label = label.substr(0, Vertex::MaxLabelLength);
+
+        Vertex& vertex = this->state.view.View(id);
+        std::copy(label.begin(), label.end(), vertex.label.begin());
+        vertex.labelSize = static_cast<u8>(label.size());
+        this->journal.VertexLabel(id, label);
+    }
+
+    void SetDirected(bool directed) {
+        this->state.view.SetDirected(directed);
+        this->journal.SetDirected(directed);
+    }
+};
+
+static Editor StartEditor() {
+    gpx::Graph graph = gpx::CreateBarabasiAlbert(200, 2, 1);
+    std::vector<f32> positions(2 * graph.Vertices());
+    for (usize i = 0; i < positions.size(); ++i) {
+        positions[i] = static_cast<f32>(i) * .75f - 100.f;
+    }
+
+    Editor editor;
+    editor.state.view = GraphView(graph, FixedGraphViewRenderer(positions));
+    editor.state.vertexColors = std::vector<u32>(graph.Vertices(), 0x336699FF);
+    editor.state.edgeColors.resize(graph.Edges().size());
+    for (usize i = 0; i < editor.state.edgeColors.size(); ++i) {
+        editor.state.edgeColors[i] = static_cast<u32>(i) * 0x01010100u | 0xFF;
+    }
+
+    editor.VertexLabel(0, "hub");
+    editor.journal.Clear();
+    return editor;
+}
+
+// Every record kind, ids past the single varint byte and labels past the maximum length
+static void EditEverything(Editor& editor) {
+    editor.AddVertex({1.5f, -2.f});
+    editor.AddEdge(200, 150, 3.f);
+    editor.AddEdge(7, 200, -1.f);
+    editor.MoveVertex(130, {9.f, 9.f});
+    editor.EdgeWeight(300, .125f);
+    editor.VertexLabel(140, "a label longer than the maximum");
+    editor.VertexLabel(0, "");
+    editor.EraseEdge(5);
+    editor.EraseVertex(3);
+    editor.SetDirected(true);
+    editor.AddEdge(150, 199, 0.f);
+}
+
+static void TestRecordEncoding() {
+    WorkspaceJournal journal;
+    journal.AddEdge(300, 1, 1.f);
+    journal.SetDirected(true);
+    journal.VertexLabel(2, "ab");
+
+    const std::vector<u8> expected = {
+        static_cast<u8>(WorkspaceRecord::AddEdge), 0xAC, 0x02, 0x01, 0x00, 0x00, 0x80, 0x3F,
+        static_cast<u8>(WorkspaceRecord::Directed), 0x01,
+        static_cast<u8>(WorkspaceRecord::VertexLabel), 0x02, 0x02, 'a', 'b'
+    };
+
+    GPX_CHECK(std::equal(journal.Records().begin(), journal.Records().end(), expected.begin(), expected.end()));
+}
+
+static void TestReplay() {
+    std::filesystem::path path = TestPath("replay.gpxw");
+    Editor editor = StartEditor();
+
+    GPX_CHECK(SaveWorkspace(path, editor.state));
+
+    std::optional<WorkspaceState> saved = LoadWorkspace(path);
+    GPX_CHECK(saved && SameState(*saved, editor.state));
+
+    // Appended in two batches, like autosaves do
+    EditEverything(editor);
+    GPX_CHECK(AppendWorkspaceJournal(path, editor.journal.Records().first(20)));
+    GPX_CHECK(AppendWorkspaceJournal(path, editor.journal.Records().subspan(20)));
+
+    std::optional<WorkspaceState> replayed = LoadWorkspace(path);
+    GPX_CHECK(replayed && SameState(*replayed, editor.state));
+
+    // Compacting into a new snapshot gives the same state with an empty journal
+    GPX_CHECK(replayed && SaveWorkspace(path, *replayed));
+    GPX_CHECK(std::filesystem::file_size(WorkspaceJournalPath(path)) == JournalHeaderSize);
+
+    std::optional<WorkspaceState> compacted = LoadWorkspace(path);
+    GPX_CHECK(compacted && SameState(*compacted, editor.state));
+
+    RemoveWorkspace(path);
+}
+
+// A record cut in half (e.g. a crash while appending) ends the replay there and is cut off the journal
+static void TestTornJournal() {
+    std::filesystem::path path = TestPath("torn.gpxw");
+    Editor editor = StartEditor();
+    GPX_CHECK(SaveWorkspace(path, editor.state));
+
+    editor.AddVertex({4.f, 4.f});
+    editor.AddEdge(0, 200, 2.f);
+    WorkspaceState expected = editor.state;
+    GPX_CHECK(AppendWorkspaceJournal(path, editor.journal.Records()));
+
+    u64 intact = std::filesystem::file_size(WorkspaceJournalPath(path));
+    editor.journal.Clear();
+    editor.MoveVertex(10, {0.f, 0.f});
+    GPX_CHECK(AppendWorkspaceJournal(path, editor.journal.Records().first(editor.journal.Records().size() - 3)));
+
+    std::optional<WorkspaceState> loaded = LoadWorkspace(path);
+    GPX_CHECK(loaded && SameState(*loaded, expected));
+    GPX_CHECK(std::filesystem::file_size(WorkspaceJournalPath(path)) == intact);
+
+    // So what is appended after it is replayed
+    editor.journal.Clear();
+    editor.EdgeWeight(0, 42.f);
+    GPX_CHECK(AppendWorkspaceJournal(path, editor.journal.Records()));
+
+    loaded = LoadWorkspace(path);
+    GPX_CHECK(loaded && loaded->view.GetGraph().Edges()[0].weight == 42.f && loaded->view.Vertices()[10].position.x != 0.f);
+
+    // Records about things that don't exist stop the replay too
+    WorkspaceJournal invalid;
+    invalid.EraseEdge(1000000);
+    invalid.AddVertex({1.f, 1.f});
+    GPX_CHECK(AppendWorkspaceJournal(path, invalid.Records()));
+
+    std::optional<WorkspaceState> stopped = LoadWorkspace(path);
+    GPX_CHECK(stopped && loaded && SameState(*stopped, *loaded));
+
+    RemoveWorkspace(path);
+}
+
+// The journal of an older snapshot, left behind when compaction is interrupted, must not be replayed over the new one
+static void TestForeignJournal() {
+    std::filesystem::path path = TestPath("foreign.gpxw");
+    std::filesystem::path stale = TestPath("foreign.stale");
+    Editor editor = StartEditor();
+    GPX_CHECK(SaveWorkspace(path, editor.state));
+
+    editor.AddVertex({0.f, 1.f});
+    GPX_CHECK(AppendWorkspaceJournal(path, editor.journal.Records()));
+    std::filesystem::copy_file(WorkspaceJournalPath(path), stale, std::filesystem::copy_options::overwrite_existing);
+
+    GPX_CHECK(SaveWorkspace(path, editor.state));
+    std::filesystem::copy_file(stale, WorkspaceJournalPath(path), std::filesystem::copy_options::overwrite_existing);
+
+    std::optional<WorkspaceState> loaded = LoadWorkspace(path);
+    GPX_CHECK(loaded && SameState(*loaded, editor.state));
+
+    // Loading started a fresh journal for the new snapshot
+    GPX_CHECK(std::filesystem::file_size(WorkspaceJournalPath(path)) == JournalHeaderSize);
+
+    std::filesystem::remove(stale);
+    RemoveWorkspace(path);
+
+    GPX_CHECK(!LoadWorkspace(path));
+    GPX_CHECK(!AppendWorkspaceJournal(path, editor.journal.Records()));
+}
+
+int main() {
+    TestRecordEncoding();
+    TestReplay();
+    TestTornJournal();
+    TestForeignJournal();
+    return TestResult();
+}
@@ -6,16 +6,38 @@ local lib = {
     "lib/Graph.cpp",
     "lib/GraphMatrix.cpp",
     "lib/GraphTypes.cpp",
+    "lib/GraphCSR.cpp",
+    "lib/MappedFile.cpp",
+    "lib/GraphFile.cpp",
+    "lib/GraphImport.cpp",
+    "lib/GraphExport.cpp",
+    "lib/CompressedGraph.cpp",
+    "lib/Coarsening.cpp",
+    "lib/SymmetricEigen.cpp",
     "lib/Algo/Hakimi.cpp",
     "lib/Algo/Kruskal.cpp",
     "lib/Algo/BFS.cpp",
     "lib/Algo/DFS.cpp",
+    "lib/Algo/Centrality.cpp",
+    "lib/Algo/Betweenness.cpp",
+    "lib/Algo/Coloring.cpp",
+    "lib/Algo/MaxFlow.cpp",
+    "lib/Algo/Matching.cpp",
+    "lib/Algo/Topological.cpp",
+    "lib/Algo/Eulerian.cpp",
+    "lib/Algo/ConfigurationModel.cpp",
+    "lib/Layout/ForceLayout.cpp",
+    "lib/Layout/MultilevelLayout.cpp",
+    "lib/Layout/SpectralLayout.cpp",
+    "lib/Layout/StressLayout.cpp",
 }
 
 local app = {
     "src/vendor.c",
     "src/main.cpp",
     "src/GraphView.cpp",
+    "src/Workspace.cpp",
+    "src/LayoutWorker.cpp",
     "src/Graphexia.cpp",
     "src/GPXRenderer.cpp",
     "src/GPXFontRenderer.cpp",
@@ -107,6 +129,8 @@ target("graphexia")
 
     set_warnings("all", "extra")
     set_policy("build.warning", true)
+    -- Nothing reads errno, without it sqrt in the layout kernels can be vectorized
+    add_cxxflags("-fno-math-errno", { tools = { "gcc", "gxx", "clang", "clangxx", "emcc" } })
     --set_policy("build.sanitizer.address", true)
     --set_policy("build.sanitizer.leak", true)
     --set_policy("build.sanitizer.memory", true)
@@ -158,3 +182,49 @@ target("graphexia")
             end
         end
     end
+
+-- The library on its own, only the tests link it
+target("graphexia-lib")
+    set_kind("static")
+    set_default(false)
+    set_languages("c++23")
+
+    set_warnings("all", "extra")
+    add_cxxflags("-fno-math-errno", { tools = { "gcc", "gxx", "clang", "clangxx", "emcc" } })
+
+    add_includedirs("include", { public = true })
+    add_files(lib)
+
+    if is_plat("linux") then
+        add_syslinks("pthread", { public = true })
+    end
+
+-- Every test is its own executable (tests/Test.hpp), 'xmake test' builds and runs all of them
+local tests = {
+    { name = "Random", files = { "tests/Random.cpp" } },
+    { name = "GraphFile", files = { "tests/GraphFile.cpp" } },
+    { name = "GraphImport", files = { "tests/GraphImport.cpp" } },
+    { name = "GraphExport", files = { "tests/GraphExport.cpp" } },
+    { name = "CompressedGraph", files = { "tests/CompressedGraph.cpp" } },
+    { name = "Eulerian", files = { "tests/Eulerian.cpp" } },
+    { name = "Layout", files = { "tests/Layout.cpp" } },
+    { name = "Workspace", files = { "tests/Workspace.cpp", "src/GraphView.cpp", "src/Workspace.cpp" } },
+}
+
+for _, test in ipairs(tests) do
+    target("test-" .. test.name)
+        set_kind("binary")
+        set_default(false)
+        set_languages("c++23")
+
+        set_warnings("all", "extra")
+        add_cxxflags("-fno-math-errno", { tools = { "gcc", "gxx", "clang", "clangxx", "emcc" } })
+        set_policy("build.sanitizer.undefined", true)
+
+        add_deps("graphexia-lib")
+        add_includedirs("src")
+        add_includedirs("vendor/include")
+        add_files(test.files)
+
+        add_tests("default")
+end